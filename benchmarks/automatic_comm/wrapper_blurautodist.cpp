@@ -13,6 +13,7 @@ int main() {
 
   int rank = tiramisu_MPI_init();
   std::vector<std::chrono::duration<double,std::milli>> duration_vector_1;
+  std::vector<std::chrono::duration<double,std::milli>> comm_vector_1;
   std::vector<std::chrono::duration<double,std::milli>> duration_vector_2;
 
   Halide::Buffer<uint32_t> input(_COLS + 2, _ROWS/_NODES+2, "input");
@@ -52,11 +53,13 @@ int main() {
       init_buffer(output, (uint32_t)0);
 
       MPI_Barrier(MPI_COMM_WORLD);
+      tiramisu_MPI_reset_comm_time();
       auto start1 = std::chrono::high_resolution_clock::now();
       blurautodist_tiramisu(input.raw_buffer(), output.raw_buffer());
       auto end1 = std::chrono::high_resolution_clock::now();
       std::chrono::duration<double,std::milli> duration1 = end1 - start1;
       duration_vector_1.push_back(duration1);
+      comm_vector_1.push_back(std::chrono::duration<double,std::milli>(tiramisu_MPI_get_comm_time()));
   }
 
   MPI_Barrier(MPI_COMM_WORLD);
@@ -92,6 +95,8 @@ int main() {
                  {median(duration_vector_1), median(duration_vector_2)});
   }
 
+  tiramisu_MPI_print_rank_times("blurautodist", median(duration_vector_1), median(comm_vector_1));
+
   tiramisu_MPI_cleanup();
 #endif
 
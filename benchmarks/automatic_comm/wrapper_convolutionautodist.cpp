@@ -10,6 +10,7 @@ int main(int, char**)
 
     int rank = tiramisu_MPI_init();
     std::vector<std::chrono::duration<double,std::milli>> duration_vector_1;
+    std::vector<std::chrono::duration<double,std::milli>> comm_vector_1;
     std::vector<std::chrono::duration<double,std::milli>> duration_vector_2;
 
     Halide::Buffer<int32_t> input (3, _COLS, _ROWS/_NODES  + 2);
@@ -46,6 +47,7 @@ int main(int, char**)
 
         MPI_Barrier(MPI_COMM_WORLD);
 
+        tiramisu_MPI_reset_comm_time();
         auto start1 = std::chrono::high_resolution_clock::now();
 
         convolutionautodist_tiramisu(input.raw_buffer(), kernel.raw_buffer(), output1.raw_buffer());
@@ -54,6 +56,7 @@ int main(int, char**)
 
         std::chrono::duration<double,std::milli> duration1 = end1 - start1;
         duration_vector_1.push_back(duration1);
+        comm_vector_1.push_back(std::chrono::duration<double,std::milli>(tiramisu_MPI_get_comm_time()));
     }
     MPI_Barrier(MPI_COMM_WORLD);
 
@@ -100,6 +103,8 @@ int main(int, char**)
          {median(duration_vector_1), median(duration_vector_2)});
     }
 
+    tiramisu_MPI_print_rank_times("convolutionautodist", median(duration_vector_1), median(comm_vector_1));
+
     tiramisu_MPI_cleanup();
     return 0;
 }
@@ -7,7 +7,9 @@
 #define _CHANNELS 3
 #define _ROWS 1600
 #define _COLS 1000
+#ifndef _NODES
 #define _NODES 16
+#endif
 
 #ifdef __cplusplus
 extern "C" {
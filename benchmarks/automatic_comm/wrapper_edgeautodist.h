@@ -9,7 +9,9 @@ extern "C" {
 #define _ROWS 1600
 #define _COLS 1000
 
+#ifndef _NODES
 #define _NODES 16
+#endif
 
 int edgeautodist_tiramisu(halide_buffer_t *, halide_buffer_t *);
 int edgeautodist_ref(halide_buffer_t *, halide_buffer_t *);
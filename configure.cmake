@@ -28,6 +28,21 @@ set(CUDNN_LOCATION /data/scratch/akkas/cudnn7)
 set(MPI_BUILD_DIR "")
 set(MPI_NODES "")
 
+# Set to TRUE to run the MPI tests, benchmarks and tutorials on the local machine only:
+# every MPI target is launched with mpirun over its number of ranks on this host
+# (oversubscribed if there are fewer cores than ranks). MPI_NODES is ignored in this mode,
+# and if MPI_BUILD_DIR is empty, mpicxx and mpirun are taken from the PATH.
+set(MPI_LOCAL FALSE)
+
+# Set to TRUE for hybrid MPI + threads runs: one rank per socket (instead of one rank per
+# node) whose parallel loops use the cores of the socket.
+set(MPI_HYBRID FALSE)
+
+# Numbers of ranks used by the scaling targets of the distributed benchmarks
+# (run_dist_benchmark_scaling_<name>). Each distributed benchmark is rebuilt for every
+# number of ranks and reports, for each rank, its compute and communication time.
+set(MPI_SCALING_RANKS 1 2 4 8 16)
+
 # Intel MKL library path. The specified folder should contain the folders
 # include and lib.
 # Example:
@@ -39,6 +39,7 @@ class send;
 class recv;
 class send_recv;
 class wait;
+class collective;
 class sync;
 class xfer_prop;
 class auto_scheduler;
@@ -82,7 +83,19 @@ enum xfer_attr {
     CPU2CPU,
     CPU2GPU,
     GPU2CPU,
-    GPU2GPU
+    GPU2GPU,
+    ALLREDUCE,
+    ALLGATHER,
+    BCAST,
+    ALLTOALL,
+    // A NONBLOCK MPI send/recv whose request is created once (MPI_Send_init, MPI_Recv_init)
+    // and restarted (MPI_Start) each time the communication is executed.
+    PERSISTENT,
+    // A BLOCK MPI send/recv lowered to one-sided communication: the send writes
+    // with MPI_Put into a window exposing the buffer of the receive.  The exchange
+    // is enclosed in two MPI_Win_fence executed by all the ranks, so the receive
+    // does not call MPI.
+    RMA
 };
 
 struct xfer {
@@ -124,6 +137,19 @@ void init();
   */
 void codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string obj_filename, const bool gen_cuda_stmt = false);
 
+/**
+  * \brief Generate code with specialized versions.
+  *
+  * \details
+  *
+  * Identical to the function above, but one version of the function is
+  * specialized for each of the bindings of the parameters in
+  * \p specializations (see function::add_specialization()).
+  */
+void codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string obj_filename,
+             const std::vector<std::map<std::string, int>> &specializations,
+             const bool gen_cuda_stmt = false);
+
 //*******************************************************
 
 /**
@@ -159,6 +185,18 @@ private:
      */
     int rank_offset = 0;
 
+    /**
+      * The buffers exposed as MPI windows to the one-sided (RMA) sends.  The
+      * id of the window of a buffer is its index in this vector.
+      */
+    std::vector<tiramisu::buffer *> rma_windows;
+
+    /**
+      * Generate the batched entry point of the function (see
+      * set_batched_entry_point()) ?
+      */
+    bool batched_entry_point;
+
     /**
       * Function arguments. These are the buffers or scalars that are
       * passed to the function.
@@ -183,6 +221,28 @@ private:
       */
     isl_ast_node *ast;
 
+    /**
+      * The specialized versions of the function added with add_version().
+      * Each version is identified using the pair <guard, ast>: \p ast is
+      * the ISL AST generated for the context of the function restricted
+      * by the condition of the version and \p guard is the runtime check
+      * of that condition.  Both are generated by calling gen_isl_ast().
+      */
+    std::vector<std::pair<isl_ast_expr *, isl_ast_node *>> version_asts;
+
+    /**
+      * The conditions (sets of constraints over the parameters of the
+      * function) of the versions added with add_version().
+      */
+    std::vector<isl_set *> version_conditions;
+
+    /**
+      * The values of the parameters of the versions added with
+      * add_specialization() (empty for the other versions).  These
+      * values are substituted in the code of the versions.
+      */
+    std::vector<std::map<std::string, int>> version_bindings;
+
     /**
       * A vector representing the parallel dimensions around
       * the computations of the function.
@@ -216,6 +276,19 @@ private:
       */
     std::vector<std::pair<std::string, int>> distributed_dimensions;
 
+    /**
+      * The number of ranks along each dimension of the process grid
+      * (outermost dimension first).  Empty if the ranks are not organized
+      * as a grid, in which case a distributed loop level is executed by the
+      * rank whose number is equal to the loop iterator.
+      */
+    std::vector<int> process_grid;
+
+    /**
+      * The order in which the ranks of the process grid are numbered.
+      */
+    tiramisu::layout_t process_grid_layout;
+
     /**
       * A vector representing the GPU block dimensions around
       * the computations of the function.
@@ -249,6 +322,26 @@ private:
       */
     std::vector<std::tuple<std::string, int, int>> unroll_dimensions;
 
+    /**
+      * A vector representing the types of the loops that the isl AST
+      * generator should generate around the computations of the function.
+      * They are identified using the tuple <computation_name, level, type>,
+      * for example the tuple <S0, 2, ast_loop_separate> indicates that the
+      * full and the partial iterations of the loop level 2 around S0 should
+      * be separated.
+      */
+    std::vector<std::tuple<std::string, int, tiramisu::ast_loop_t>> ast_loop_types;
+
+    /**
+      * A vector representing the loop levels that stream buffers around
+      * the computations of the function (see computation::stream()).
+      * They are identified using the tuple <computation_name, level,
+      * buffers, rows>: each iteration of the loop level around the
+      * computation uses \p rows rows (elements of the outermost dimension)
+      * of each of the \p buffers.
+      */
+    std::vector<std::tuple<std::string, int, std::vector<tiramisu::buffer *>, int>> stream_dimensions;
+
     /**
       * Body of the function (a vector of computations).
       * The order of the computations in the vector does not have any
@@ -279,6 +372,11 @@ private:
      */
     isl_set *context_set;
 
+    /**
+     * Incremented each time the context set of the function changes.
+     */
+    int context_set_version;
+
     /**
      * The names of the iterators.
      */
@@ -324,6 +422,28 @@ private:
       */
     void add_unroll_dimension(std::string stmt_name, int L, int factor);
 
+    /**
+      * Set the type of the loop that the isl AST generator generates
+      * for the loop level \p L of the computation \p stmt_name.
+      * The dimension 0 represents the outermost loop level.
+      */
+    void add_ast_loop_type(std::string stmt_name, int L, tiramisu::ast_loop_t type);
+
+    /**
+      * Tag the loop level \p L of the computation \p stmt_name to stream
+      * \p rows rows of each of the buffers \p buffers per iteration.
+      * The dimension 0 represents the outermost loop level.
+      */
+    void add_stream_dimension(std::string stmt_name, int L, const std::vector<tiramisu::buffer *> &buffers,
+                              int rows);
+
+    /**
+      * Return the isl AST build options that apply the loop types set with
+      * add_ast_loop_type() when the AST is generated from the schedule map
+      * \p schedule.
+      */
+    isl_union_map *get_ast_build_options(isl_union_map *schedule) const;
+
     /**
      * Get live in/out computations in the function.
      */
@@ -486,6 +606,35 @@ protected:
       */
     isl_union_map *compute_dep_graph();
 
+    /**
+      * Compute the dependence distances between \p producer and
+      * \p consumer at the loop levels 0 up to \p level (included).
+      *
+      * The accesses of \p consumer to \p producer are mapped into the
+      * time-space domain using the current schedules of the two computations,
+      * then the difference between the consumer and the producer instances is
+      * computed. Only the dynamic dimensions corresponding to the loop levels
+      * 0 to \p level are kept, so the result has \p level + 1 dimensions.
+      *
+      * Return NULL if \p consumer does not read \p producer.
+      */
+    isl_set *compute_fusion_distances(tiramisu::computation *producer,
+                                      tiramisu::computation *consumer, int level);
+
+    /**
+      * Return true if the computations of \p chain can be executed in that
+      * order when each computation chain[i] is fused with chain[i-1] at the
+      * loop level levels[i] (levels[0] is ignored).
+      *
+      * Two computations of the chain share the loop levels up to the minimum
+      * of the levels that separate them.  Fusing them is legal if all the
+      * dependence distances between them are lexicographically non-negative
+      * at these shared levels.  In addition, a shared loop level tagged as
+      * parallel or vectorized must not carry any dependence.
+      */
+    bool is_fusion_legal(const std::vector<tiramisu::computation *> &chain,
+                         const std::vector<int> &levels);
+
     /**
       * The Tiramisu autoscheduler starts by creating an initial
       * ordered graph of computations. This graph represents the
@@ -717,6 +866,12 @@ protected:
       */
     bool should_unroll(const std::string &comp, int lev) const;
 
+    /**
+      * Return true if the computation \p comp streams buffers
+      * at the loop level \p lev.
+      */
+    bool should_stream(const std::string &comp, int lev) const;
+
     /**
       * Return true if the computation \p comp should be vectorized
       * at the loop level \p lev.
@@ -729,16 +884,74 @@ protected:
       */
     bool should_distribute(const std::string &comp, int lev) const;
 
+    /**
+      * Return the dimension of the process grid on which the loop level
+      * \p lev of the computation \p comp is distributed, or -1 if the
+      * loop level is distributed on the linear rank number.
+      * The k-th distributed loop level of a computation is mapped to the
+      * k-th dimension of the process grid if the computation has as
+      * many distributed loop levels as the process grid has dimensions
+      * (and the grid has more than one dimension).
+      */
+    int get_distributed_grid_dimension(const std::string &comp, int lev) const;
+
+    /**
+      * \brief Distribute the computations that write the distributed buffers.
+      *
+      * \details For each buffer distributed with buffer::distribute(), the
+      * loop levels of the computations that store their results in the buffer
+      * are split so that each rank computes the part of the buffer that it
+      * owns (owner-computes rule), the outer loop levels are distributed and
+      * the buffer is resized to the size of the part of each rank.  The
+      * communications needed by the distributed computations are then
+      * generated using computation::gen_communication().
+      * Called by codegen().  A buffer is distributed only once, so that
+      * calling codegen() again does not split the computations again.
+      */
+    void distribute_buffers();
+
     /**
       * This computation requires a call to the MPI_Comm_rank function.
       */
     bool needs_rank_call() const;
 
+    /**
+      * Return true if a communication is nested in a parallel loop (one of its
+      * own loops, or the loop of a computation that it is fused with), in which
+      * case MPI is called concurrently by several threads and should be
+      * initialized with MPI_THREAD_MULTIPLE (see tiramisu_MPI_init_hybrid()).
+      */
+    bool communicates_in_parallel_loops() const;
+
     /**
       * Lift certain computations for distributed execution to function calls.
       */
     void lift_mpi_comp(tiramisu::computation *comp);
 
+    /**
+      * Return the id of the MPI window that exposes the buffer \p buf to the
+      * one-sided (RMA) communications, and create it if needed.  The windows
+      * are created by the first call of the function and freed by
+      * tiramisu_MPI_cleanup().
+      */
+    int get_rma_window_id(tiramisu::buffer *buf);
+
+    /**
+      * Enclose each one-sided (RMA) exchange in two fences on its window: one
+      * at the root level right before the send and one right after the receive.
+      * The send and the receive should be ordered at the root level with the
+      * high level scheduling commands.  Called by lift_dist_comps().
+      */
+    void gen_rma_fences();
+
+    /**
+      * Coalesce the fine-grained MPI communications: each blocking send and
+      * its matching receive are merged into one message per destination rank
+      * over their innermost loop levels (see send::coalesce()).
+      * Called by codegen().
+      */
+    void coalesce_communication();
+
     /**
       * Lift certain computations for distributed execution to function calls.
       */
@@ -827,6 +1040,57 @@ public:
       */
     void add_context_constraints(const std::string &new_context);
 
+    /**
+      * \brief Generate a version of the function specialized for the
+      * values of the parameters that satisfy \p condition.
+      *
+      * \details The code of the version is generated assuming that the
+      * constraints \p condition hold in addition to the context of the
+      * function, so it does not have the bounds and the guards that these
+      * constraints make useless.  A runtime check at the entry of the
+      * function executes the first version whose condition holds, or the
+      * generic code if none holds.
+      *
+      * For example, if the loops over N are tiled by 4, the following
+      * call generates a version without partial tiles:
+      *     f.add_version("[N]->{: N mod 4 = 0}");
+      *
+      * \p condition is a set of constraints over the parameters of the
+      * function, similar to add_context_constraints().
+      */
+    void add_version(const std::string &condition);
+
+    /**
+      * \brief Generate a version of the function specialized for the values
+      * \p values of its parameters.
+      *
+      * \details This is a version (see add_version()) whose condition is
+      * that each parameter is equal to its value in \p values, for example
+      *     f.add_specialization({{"N", 224}, {"M", 64}});
+      * generates a version for "[M,N]->{: M = 64 and N = 224}".  The values
+      * of the parameters are also substituted in the code of the version, so
+      * its loops have constant extents.
+      */
+    void add_specialization(const std::map<std::string, int> &values);
+
+    /**
+      * \brief Also generate a batched entry point for the function.
+      *
+      * \details If \p v is true, gen_halide_obj() also generates the function
+      * "<name>_batched" that calls the function \p batch_size times in
+      * a parallel loop.  Its first argument is the int32_t \p batch_size
+      * and each of its other arguments is an array of \p batch_size pointers
+      * to the halide_buffer_t of the corresponding argument of the function.
+      * For example, for a function "saxpy" with the arguments x and y, the
+      * arrays are passed as void pointers:
+      *     int saxpy_batched(int32_t batch_size, void *x_batch, void *y_batch);
+      * The buffers of different elements of the batch should not overlap,
+      * except for the input buffers.  This amortizes the cost of the call
+      * over many small problems and runs them in parallel.  It returns 0, or
+      * the first nonzero value returned by the function for an element.
+      */
+    void set_batched_entry_point(bool v);
+
     /**
       * \brief Align the schedules of all the computations of this
       * function.
@@ -972,6 +1236,34 @@ public:
       */
     void dump_trimmed_time_processor_domain() const;
 
+    /**
+      * \brief Fuse producer/consumer computations automatically.
+      *
+      * \details This pass looks at the order of the computations of the
+      * function (the order specified using after(), then(), ... or the
+      * declaration order if no order was specified) and, for each consumer,
+      * tries to fuse it with the computation that precedes it at the deepest
+      * loop level where fusion is legal.
+      *
+      * Legality is checked using the dependence distances between all the
+      * computations that end up sharing loops.  If fusion at a given level is
+      * illegal only because of constant negative distances, the consumer is
+      * shifted (see computation::shift()) to make the distances non-negative.
+      *
+      * Each candidate level is scored: the number of accesses of the consumer
+      * to its predecessor, multiplied by the number of shared loop levels, is
+      * the reuse gained.  A shared loop level that is parallelized or
+      * vectorized in only one of the two computations (parallelism or
+      * vectorization lost), and each shift needed, decrease the score.
+      * Fusion is only applied if it increases the score.
+      *
+      * Only linear orders are handled (each computation has at most one
+      * computation scheduled directly after it).  This function should be
+      * called after the other scheduling commands and before code generation.
+      * Low level scheduling commands are not supported.
+      */
+    void fuse_automatically();
+
     /**
       * \brief Generate C code and print it on stdout.
       * \details Currently C code code generation is very basic and does not
@@ -1015,10 +1307,37 @@ public:
     void gen_cuda_stmt();
 
     /**
-      * Generate an isl AST that represents the function.
+      * Generate an isl AST that represents the function, and one
+      * isl AST for each of its versions (see add_version()).
+      * The AST is generated from the schedule tree returned by
+      * gen_schedule_tree() if global::set_schedule_tree_codegen() was used.
+      * The AST is generated again in full each time the function is
+      * compiled: only the time-space domains of the computations are reused
+      * (see computation::is_time_space_domain_up_to_date()).
       */
     void gen_isl_ast();
 
+    /**
+      * Generate an isl AST for the scheduled computations of the function,
+      * assuming that the constraints of \p context hold (\p context can
+      * be NULL).  This is called by gen_isl_ast() for the function and for
+      * each of its versions.
+      */
+    isl_ast_node *gen_isl_ast_from_context(isl_set *context);
+
+    /**
+      * Build an isl schedule tree equivalent to the trimmed time-processor
+      * domains of the scheduled computations ordered lexicographically.
+      * The static dimensions of the schedules become sequence nodes and the
+      * dynamic dimensions become band nodes (one band per loop level).
+      * The trailing dimensions that are constant for all the computations
+      * of a subtree (e.g. the dimensions added by align_schedules()) do not
+      * generate any node.
+      * Return NULL if a static dimension of a computation is not constant;
+      * the caller should then fall back to the flat schedule maps.
+      */
+    isl_schedule *gen_schedule_tree() const;
+
     /**
       * Generate the time-space domain of the function.
       *
@@ -1034,6 +1353,85 @@ public:
       */
     constant* get_invariant_by_name(std::string str) const;
 
+    /**
+      * \brief Apply overlapped tiling on a pipeline of computations.
+      *
+      * \details \p stages is a chain of computations where each stage
+      * consumes the stages that precede it (typically the stages of a
+      * multi-stage stencil).  The outermost sizes.size() loop levels of all
+      * the stages are tiled using the tile sizes \p sizes, the stages are
+      * fused at the innermost tile loop level and the outermost tile loop
+      * is parallelized.
+      *
+      * Each stage is computed, in each tile, over the region needed by the
+      * stages that follow it.  That region is the tile extended by a halo
+      * that is derived automatically from the constant offsets of the accesses
+      * of the consumers to the stage (the halo accumulates along the chain).
+      * The halo is computed redundantly by neighbouring tiles, so tiles do not
+      * need to synchronize.  Recomputation is bounded: the halo of a stage
+      * must not be larger than the tile size, otherwise an error is raised.
+      * The halo is computed by copies of the stage (see add_definitions()),
+      * so the schedule of each copy stays single-valued.
+      *
+      * The intermediate stages (all the stages except the last one) are stored
+      * in scratch buffers that are allocated in each tile and indexed modulo
+      * the size of the tile extended by its halo, so that they stay in
+      * cache and the parallel tiles do not share any storage.  store_in()
+      * should not be called on the intermediate stages.  Their untiled
+      * dimensions should have constant bounds.
+      *
+      * The accesses of the consumers to the stages must have constant offsets
+      * on the tiled dimensions, and the tiled loop levels must not have
+      * been transformed before this call.
+      *
+      * \p sizes should have one, two or three elements.
+      */
+    void overlapped_tile(std::vector<tiramisu::computation *> stages, std::vector<int> sizes);
+
+    /**
+      * \brief Organize the ranks as a grid of processes.
+      *
+      * \details \p ranks_per_dimension is the number of ranks along each
+      * dimension of the grid (outermost dimension first).  By default the
+      * ranks are numbered in row-major order, so the coordinate k of the rank
+      * r is (r / (P_{k+1} * ... * P_{n-1})) % P_k.  If \p layout is
+      * tiramisu::l_column_major, the coordinate k of the rank r is
+      * (r / (P_0 * ... * P_{k-1})) % P_k.
+      *
+      * A computation that is distributed on n loop levels (using
+      * tag_distribute_level()), where n is the number of dimensions of the
+      * grid, has its k-th distributed loop level mapped to the k-th dimension
+      * of the grid: the iteration i of that loop level is executed by the ranks
+      * whose coordinate k is i.  This allows 2D and 3D decompositions, e.g.
+      *
+      * \code
+      * f.set_process_grid({4, 4});
+      * c.split(i, 64, i0, i1);
+      * c.split(j, 64, j0, j1);
+      * c.interchange(i1, j0);
+      * c.tag_distribute_level(i0);
+      * c.tag_distribute_level(j0);
+      * \endcode
+      *
+      * The computations that are distributed on a single loop level
+      * (and the communications generated by gen_communication())
+      * use the linear rank number.
+      */
+    void set_process_grid(std::vector<int> ranks_per_dimension,
+                          tiramisu::layout_t layout = tiramisu::l_row_major);
+
+    /**
+      * Return the number of ranks along each dimension of the process grid.
+      * The returned vector is empty if set_process_grid() was not called.
+      */
+    const std::vector<int> &get_process_grid() const;
+
+    /**
+      * Return the number of ranks between two ranks whose coordinates differ
+      * by one along the dimension \p grid_dimension of the process grid.
+      */
+    int get_process_grid_stride(int grid_dimension) const;
+
     /**
       * Set the arguments of the function.
       * The arguments of the function are provided as a vector of
@@ -1051,6 +1449,16 @@ public:
      */
     void codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string obj_filename, const bool gen_cuda_stmt = false);
 
+    /**
+      * Generate code for the function with one version specialized for each
+      * of the bindings of the parameters in \p specializations (see
+      * add_specialization()) and a generic version.  The generated function
+      * executes the version that corresponds to the values of its parameters.
+      */
+    void codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string obj_filename,
+                 const std::vector<std::map<std::string, int>> &specializations,
+                 const bool gen_cuda_stmt = false);
+
     /**
      * \brief Set the context of the function.
      * \details A context is an ISL set that represents constraints over the
@@ -1147,6 +1555,32 @@ private:
      */
     cuda_ast::memory_location location;
 
+    /**
+      * The dimensions of the buffer that are distributed across the ranks,
+      * the number of ranks along each of these dimensions, the number of
+      * elements of each dimension that are partitioned across the ranks and
+      * the order in which the ranks are numbered (see distribute()).
+      */
+    // @{
+    std::vector<int> distributed_dimensions;
+    std::vector<int> distribution_grid;
+    std::vector<int> distribution_block;
+    tiramisu::layout_t distribution_layout;
+    // @}
+
+    /**
+      * True once the computations that store their results in the buffer
+      * were distributed and the buffer was resized (see
+      * function::distribute_buffers()).
+      */
+    bool distribution_applied;
+
+    /**
+      * The file from which the buffer is mapped (see set_storage_file()).
+      * The buffer is allocated in memory if it is empty.
+      */
+    std::string storage_file;
+
 protected:
     /**
      * Set the type of the argument. Three possible types exist:
@@ -1358,6 +1792,26 @@ public:
       */
     void set_automatic_gpu_copy(bool automatic_gpu_copy);
 
+    /**
+      * \brief Map the buffer from the file \p file_name instead of
+      * allocating it in memory.
+      *
+      * \details This is useful for temporary buffers that do not fit in
+      * memory: the operating system reads and writes their pages from and
+      * to the file on demand (see computation::stream() to read them in
+      * and write them out ahead of time).  The file is created if it does
+      * not exist and is extended to the size of the buffer; it is kept
+      * after the function returns.
+      * Only temporary buffers allocated automatically can be mapped.
+      */
+    void set_storage_file(const std::string &file_name);
+
+    /**
+      * Return the file from which the buffer is mapped (empty if it is
+      * allocated in memory).
+      */
+    const std::string &get_storage_file() const;
+
     /**
      * Return true if all extents of the buffer are literal integer
      * contants (e.g., 4, 10, 100, ...).
@@ -1375,6 +1829,61 @@ public:
      */
     void mark_as_allocated();
 
+    /**
+      * \brief Distribute the buffer across the ranks.
+      *
+      * \details The dimension \p dims[k] of the buffer is partitioned into
+      * \p processor_grid[k] contiguous parts of \p block[k] / \p processor_grid[k]
+      * elements (rounded up).  Each rank owns one part of the buffer: the part
+      * whose coordinates are the coordinates of the rank in the process grid
+      * (see function::set_process_grid()).  \p layout is the order in which
+      * the ranks are numbered in the grid.  If \p block is empty, the whole
+      * extent of each distributed dimension is partitioned (the extents should
+      * then be constant).
+      *
+      * The buffer should be declared with its global size.  During code
+      * generation (see function::distribute_buffers()):
+      * - the computations that store their results in the buffer are
+      * distributed (owner-computes rule): their loop levels that iterate over
+      * the distributed dimensions are split and the outer loop levels are
+      * distributed,
+      * - the buffer is resized to the size of the part owned by a rank (the
+      * buffer is indexed with local coordinates), and
+      * - the send and receive computations that are needed by the distributed
+      * computations are generated.
+      *
+      * For example, a row-wise distribution of a blur on 10 ranks is
+      *
+      * \code
+      * buffer b_img("b_img", {ROWS, COLS}, p_uint32, a_input, &f);
+      * buffer b_blur("b_blur", {ROWS, COLS}, p_uint32, a_output, &f);
+      * b_img.distribute({0}, {10});
+      * b_blur.distribute({0}, {10});
+      * \endcode
+      *
+      * Each distributed dimension should be indexed by a loop iterator (in the
+      * same order) in the computations that store their results in the buffer.
+      */
+    void distribute(std::vector<int> dims, std::vector<int> processor_grid, std::vector<int> block = {},
+                    tiramisu::layout_t layout = tiramisu::l_row_major);
+
+    /**
+      * Return true if the buffer is distributed across the ranks (see distribute()).
+      */
+    bool is_distributed() const;
+
+    /**
+      * Return the distributed dimensions of the buffer, the number of ranks
+      * along each of them, the number of elements of each of them that are
+      * partitioned and the order of the ranks (see distribute()).
+      */
+    // @{
+    const std::vector<int> &get_distributed_dimensions() const;
+    const std::vector<int> &get_distribution_grid() const;
+    const std::vector<int> &get_distribution_block() const;
+    tiramisu::layout_t get_distribution_layout() const;
+    // @}
+
     /* Tag the buffer as located in the GPU global memory. */
     void tag_gpu_global();
     /** Tag the buffer as located in the GPU register memory.
@@ -1422,6 +1931,7 @@ class computation
     friend send;
     friend recv;
     friend tiramisu::wait;
+    friend collective;
     friend cuda_ast::generator;
 
 private:
@@ -1616,6 +2126,22 @@ private:
       */
     isl_set *time_processor_domain;
 
+    /**
+      * Incremented each time the iteration domain or the schedule of the
+      * computation is set.
+      */
+    int schedule_version;
+
+    /**
+      * The versions of the schedule of the computation and of the context of
+      * its function (function::context_set_version) from which
+      * time_processor_domain was computed.  The time-processor domain is only
+      * computed again when one of them changes, e.g., when the function is
+      * compiled again after the schedule of some of its computations was
+      * modified.
+      */
+    std::pair<int, int> time_processor_domain_version;
+
     /**
      * The shape of the thread block that this computation is mapped to in case
      * a gpu_tile operation is done.
@@ -1633,9 +2159,9 @@ private:
     bool _drop_rank_iter;
 
     /**
-     * If _drop_rank_iter == true, this is the level to drop
+     * If _drop_rank_iter == true, these are the levels to drop
      */
-    var drop_level;
+    std::vector<var> drop_levels;
 
     /**
       * If the computation represents a library call, this will contain the
@@ -1664,6 +2190,19 @@ private:
       */
     isl_map *wait_access_map = nullptr;
 
+    /**
+      * If the computation is a one-sided (RMA) send, this indicates which argument
+      * of the library call is the displacement of the data in the window of the receiver.
+      */
+    int rma_argument_idx;
+
+    /**
+      * If the computation is a one-sided (RMA) send, this maps each iteration
+      * of the send to the element of the buffer of the receiver that it writes
+      * (it is the access relation of the matching receive).
+      */
+    isl_map *rma_access_map = nullptr;
+
     /**
       * By default, this becomes an o_access to signify that we are writing into a location. However, it can be changed
       * to something like o_address_of to indicate that we don't want to do a store to the location, rather we just
@@ -2090,7 +2629,7 @@ private:
       */
     bool should_drop_rank_iter() const;
 
-    int get_level_to_drop();
+    std::vector<int> get_levels_to_drop();
 
     /**
       * Assign a name to iteration domain dimensions that do not have a name.
@@ -2264,6 +2803,27 @@ private:
       */
     void shift(int L0, int n);
 
+    /**
+      * Split the loop level \p L0 into an outer loop that iterates over tiles
+      * of size \p sizeX and an inner loop whose iterator keeps the value of
+      * the original iterator.  The iteration x belongs to the tile
+      * floor((x + \p offset) / \p sizeX), so a non-zero \p offset moves the
+      * iterations to a neighbouring tile.
+      *
+      * function::overlapped_tile() uses copies of a computation split with
+      * different offsets to compute the halo of each tile.  Each copy has a
+      * single-valued schedule.
+      */
+    void overlapped_split(int L0, int sizeX, int offset);
+
+    /**
+      * Return the dependence distances of the computation on itself at the
+      * loop levels 0 to \p L1, restricted to the dependences that are not
+      * carried by the loop levels outer to \p L0.
+      * Return NULL if the computation does not read itself.
+      */
+    isl_set *compute_self_dependence_distances(int L0, int L1);
+
     /**
       * Simplify \p set using the context and by calling
       * set coalescing.
@@ -2370,6 +2930,12 @@ private:
       */
     int get_distributed_dimension();
 
+    /**
+      * Return the distributed dimensions of a computation (in increasing
+      * order of loop level).
+      */
+    std::vector<int> get_distributed_dimensions();
+
     /**
       * Return names of trimmed time space domain dimensions.
       */
@@ -2406,9 +2972,18 @@ private:
       *
       * Given the iteration domain of send and receive, this function creates xfers, schedules them,
       * and handles the storage of the receives.
-      * Currently, this process works for programs that distribute the outermost loop.
-      */
-    void gen_communication_code(isl_set*recv_it, isl_set* send_it, int communication_id, std::string computation_name);
+      * The k-th distributed loop level of the consumer is associated with the
+      * k-th loop level that follows its last distributed loop level: the
+      * received data is stored in the buffer of the producer after the local
+      * data along that loop level (i.e., at the offset "extent of the loop
+      * level" + index of the data in the sender), and the buffer is extended
+      * accordingly.
+      * If \p nonblocking is true, the send and the receive are non-blocking
+      * and the caller should schedule the waits.  The generated transfer is
+      * returned.
+      */
+    xfer gen_communication_code(isl_set*recv_it, isl_set* send_it, int communication_id, std::string computation_name,
+                                bool nonblocking = false);
 
 protected:
 
@@ -2430,6 +3005,11 @@ protected:
       * \code
       * [r] -> { c[i] -> c[o0] : o0 = i and r >= 0 and r <= 4 and i >= 2r and i <= 1 + 2r }
       * /endcode
+      *
+      * If the computation is distributed on a process grid (see
+      * function::set_process_grid()), the coordinate k of the rank r
+      * is equal to the k-th distributed loop level.  The distributed loop
+      * levels can be inner loop levels.
      */
     isl_map* construct_distribution_map(tiramisu::rank_t rank_type);
 
@@ -2448,6 +3028,11 @@ protected:
       */
     isl_ast_expr *wait_index_expr;
 
+    /**
+      * An index expression into the buffer of the receiver of a one-sided (RMA) send.
+      */
+    isl_ast_expr *rma_index_expr;
+
     /**
       * Dummy constructor for derived classes.
       */
@@ -2851,6 +3436,8 @@ public:
 
     virtual bool is_wait() const;
 
+    virtual bool is_collective() const;
+
     /**
        * \brief Add a let statement that is associated to this computation.
        * \details The let statement will be executed before the computation
@@ -3475,12 +4062,22 @@ public:
       * In this representation, the logical time of execution and the
       * processor where the computation will be executed are both
       * specified.  The memory location where computations will be
-      * stored in memory is not specified at the level.
+      * stored in memory is not specified at the level.  Nothing is done if
+      * the time-space domain is up to date.
       */
     void gen_time_space_domain();
 
+    /**
+      * Return true if the time-space domain of the computation was computed
+      * from its current iteration domain and schedule, and from the current
+      * context of its function.
+      */
+    bool is_time_space_domain_up_to_date() const;
+
     /**
       * Specify that the rank loop iterator should be removed from linearization.
+      * This can be called once for each distributed loop level (e.g., when
+      * the computation is distributed on a process grid).
       */
     void drop_rank_iter(var level);
 
@@ -3541,6 +4138,12 @@ public:
       */
     computation *get_successor();
 
+    /**
+      * Return true if this computation and \p comp share the loop levels
+      * 0 to \p level, i.e., if they are fused at the loop level \p level.
+      */
+    bool is_fused_with(computation *comp, int level);
+
     /**
       * Returns the \p index update that has been added to this computation such that:
       * - If \p index == 0, then this computation is returned.
@@ -3868,6 +4471,113 @@ public:
       */
     virtual void skew(int i, int j, int k, int l, int factor);
 
+    /**
+      * \brief Apply diamond tiling on the time loop level \p L0 and the
+      * space loop level \p L1 of a time-iterated computation.
+      *
+      * \details The tiles are delimited by the hyperplanes (f*L0 + L1) and
+      * (f*L0 - L1), where the slope f is the smallest integer such that
+      * f*dt >= |ds| for every dependence distance (dt, ds) of the computation
+      * on itself.  The distances are computed from the accesses of the
+      * computation and must be constant, and every dependence must be carried
+      * by \p L0.  \p size is the width of the tiles along each hyperplane.
+      *
+      * The loop level \p L0 is replaced by three loop levels: a wavefront of
+      * tiles, the tiles of the wavefront and the original time loop. All the
+      * tiles of a wavefront are independent (this includes the first wavefront,
+      * so tiles start concurrently) and their loop level is parallelized.
+      *
+      * For example, for a 1D Jacobi stencil (dependence distances (1, -1),
+      * (1, 0) and (1, 1)), the slope is 1 and the loops (t, i) become
+      * (w, p, t, i) where p = floor((t + i)/size) and
+      * w = floor((t + i)/size) + floor((t - i)/size).
+      *
+      * \p L0 and \p L1 should be consecutive loop levels.
+      */
+    //@{
+    virtual void diamond_tile(var L0, var L1, int size);
+    virtual void diamond_tile(int L0, int L1, int size);
+    //@}
+
+    /**
+      * \brief Parallelize the loop levels \p L0 and \p L1 using a wavefront.
+      *
+      * \details This is useful when both loop levels carry dependences, so
+      * parallelize() cannot be applied to any of them. The loop nest is skewed
+      * by a factor f computed from the dependence distances of the computation
+      * on itself (which must be constant), so that all the dependences are
+      * carried by the wavefront (f*L0 + L1). The wavefront becomes the outer
+      * loop level and the inner loop level (\p L0) is parallelized.
+      *
+      * For example, if the computation has the dependence distances (1, 0)
+      * and (0, 1), the loops (i, j) become (i + j, i), where the loop level
+      * i is parallel.
+      *
+      * If \p sizeX and \p sizeY are provided, a tiled wavefront is applied:
+      * the loop nest is skewed so that all the dependence distances are
+      * non-negative, tiled using the tile sizes \p sizeX and \p sizeY,
+      * and the wavefront is applied on the tile loops. The tiles of a
+      * wavefront are executed in parallel.
+      *
+      * \p L0 and \p L1 should be consecutive loop levels.
+      */
+    //@{
+    virtual void wavefront(var L0, var L1);
+    virtual void wavefront(var L0, var L1, int sizeX, int sizeY);
+    virtual void wavefront(int L0, int L1);
+    virtual void wavefront(int L0, int L1, int sizeX, int sizeY);
+    //@}
+
+    /**
+      * \brief Prefetch the data of \p input that is read by this computation
+      * \p distance iterations ahead of the loop \p L.
+      *
+      * \details For every access of this computation to \p input, a new
+      * computation that prefetches the address accessed \p distance
+      * iterations later is created.  The prefetch is lowered to the prefetch
+      * intrinsic of Halide (a prefetch of one cache line).  That computation
+      * has the same schedule as this computation and is ordered right after
+      * it in its innermost loop level (or in the loop level above it if the
+      * innermost loop level is vectorized).  Indirect accesses (e.g., A(B(i)))
+      * are supported: the index B(i + distance) is loaded and the address of
+      * A(B(i + distance)) is prefetched.
+      *
+      * The prefetch is only executed in the iterations i for which the
+      * iteration i + distance is in the iteration domain of this computation,
+      * so the indices of an indirect access are never loaded out of bounds.
+      *
+      * \p L should be the name of one of the dimensions of the iteration domain.
+      *
+      * This function should be called after all the other loop transformations
+      * of the computation, since they are not applied to the prefetches.
+      *
+      * For example
+      *
+      * \code
+      * C.prefetch(A, i, 16);
+      * \endcode
+      *
+      * would prefetch A(i+16, j) during the iteration (i, j) of C if C reads A(i, j).
+      */
+    void prefetch(computation &input, var L, int distance);
+
+    /**
+      * \brief Prefetch the accesses of this computation that are not
+      * contiguous in memory.
+      *
+      * \details Call prefetch() on the innermost dimension of the iteration
+      * domain for every input of this computation that is accessed
+      * indirectly (i.e., an access that is used in the indices of another
+      * access) or with a stride (i.e., an access where the innermost
+      * dimension of the iteration domain is used in an index other than the
+      * last one, or is multiplied in the last index). Contiguous accesses are
+      * already handled by the hardware prefetcher.
+      *
+      * \p distance is the number of iterations ahead of which the data
+      * is prefetched.
+      */
+    void prefetch_automatically(int distance = 16);
+
     /**
       * Split the loop level \p L0 of the iteration space into two
       * new loop levels.
@@ -3960,6 +4670,23 @@ public:
     void tag_distribute_level(int L);
     // @}
 
+    /**
+      * \brief Distribute the loop level \p L on \p number_of_ranks ranks
+      * using a block-cyclic distribution.
+      *
+      * \details The loop level \p L is split into three loop levels:
+      * \p L_cycle, \p L_rank and \p L_block. The loop level \p L_block
+      * iterates over the \p block_size iterations of a block, \p L_rank
+      * is the rank that executes the block (it is tagged to be distributed)
+      * and \p L_cycle iterates over the cycles of \p number_of_ranks blocks.
+      * The rank r executes the blocks r, r + number_of_ranks, ...
+      *
+      * The extent of \p L does not need to be a multiple of
+      * block_size * number_of_ranks.
+      */
+    void distribute_block_cyclic(tiramisu::var L, int block_size, int number_of_ranks,
+                                 tiramisu::var L_cycle, tiramisu::var L_rank, tiramisu::var L_block);
+
     /**
       * Tag the loop level \p L to be unrolled.
       *
@@ -3988,6 +4715,53 @@ public:
      */
     void tag_unroll_level(int L, int F);
 
+    /**
+      * Set the type of the loop that the isl AST generator generates for
+      * the loop level \p L of this computation:
+      * - ast_loop_separate generates separate loops for the full and the
+      * partial iterations of \p L (e.g. the full tiles do not have any
+      * min/max bound),
+      * - ast_loop_unroll completely unrolls \p L (its extent should be a
+      * small constant),
+      * - ast_loop_atomic generates a single loop for \p L,
+      * - ast_loop_default lets the AST generator decide.
+      *
+      * The loops generated for \p L are shared with the computations
+      * that are fused with this computation at \p L, so their types
+      * should be identical.  A loop unrolled by the AST generator does not
+      * generate a loop in the Halide statement, so the loop levels inside
+      * it should not be tagged (e.g. with tag_parallel_level()).
+      */
+    void set_ast_loop_type(tiramisu::var L, tiramisu::ast_loop_t type);
+
+    /**
+     * Identical to
+     *     void set_ast_loop_type(tiramisu::var L, tiramisu::ast_loop_t type);
+     */
+    void set_ast_loop_type(int L, tiramisu::ast_loop_t type);
+
+    /**
+      * \brief Process the loop level \p L in tiles of \p rows iterations
+      * and stream the buffers \p buffers tile by tile.
+      *
+      * \details \p L is split into \p L_outer and \p L_inner (the inner loop
+      * has \p rows iterations).  The iteration i of \p L should access the row
+      * i (the element i of the outermost dimension) of each buffer in
+      * \p buffers, so each iteration of \p L_outer uses a tile of \p rows
+      * rows of each buffer.  At the beginning of the iteration t of
+      * \p L_outer, a helper thread starts reading the tile t + 1 in and
+      * writing the tile t - 1 out, while the tile t is computed (double
+      * buffering).  This is useful for buffers mapped from files (see
+      * buffer::set_storage_file()) or input and output buffers mapped by
+      * the caller, when they do not fit in memory.
+      *
+      * \p L_outer should be a sequential loop.  The computation should be
+      * stored (store_in()) before it is streamed: an error is reported if
+      * \p L does not index the outermost dimension of the buffers.
+      */
+    void stream(tiramisu::var L, int rows, const std::vector<tiramisu::buffer *> &buffers,
+                tiramisu::var L_outer, tiramisu::var L_inner);
+
     /**
       * \brief Schedule this computation to run before the computation \p next_computation
       * at the loop level \p L and return \p next_computation.
@@ -4183,9 +4957,43 @@ public:
       * xfers, schedule the send, receive at root level if no computation was scheduled before,
       * map the received data to correct locations and allocate the required extra memory.
       *
+      * The distributed loop levels can be inner loop levels and the
+      * computation can be distributed on several loop levels if a process
+      * grid is defined (see function::set_process_grid()).  The local loop
+      * levels of the producer (i.e., its loop levels except the distributed
+      * ones) should match the dimensions of its iteration domain, which is
+      * not the case for a block-cyclic distribution
+      * (see distribute_block_cyclic()).
       */
     void gen_communication();
 
+    /**
+      * \brief Generate communication code that overlaps with the computation.
+      *
+      * Same as gen_communication(), but the sends and the receives are
+      * non-blocking (NONBLOCK, ASYNC) and the computation is split into an
+      * interior region and a boundary region.  The boundary region is the set
+      * of iterations that read data owned by other ranks (derived from the
+      * access relations of the computation).  The generated code is:
+      *
+      * \code
+      * post all the sends and the receives;
+      * compute the interior region;
+      * wait for all the sends and the receives;
+      * compute the boundary region;
+      * \endcode
+      *
+      * so that the communication latency is hidden by the computation of the
+      * interior region.  The boundary region is an update of this computation
+      * that can be retrieved with get_last_update().  The buffers that store
+      * the MPI requests are allocated automatically, so the loop levels of
+      * the communications should have constant bounds.
+      *
+      * Like gen_communication(), this function should be called after the
+      * computation is ordered with respect to the other computations.
+      */
+    void gen_overlapped_communication();
+
     /**
       * Same as gen_communication(), but schedules send/recv at level l.
       *
@@ -4635,6 +5443,7 @@ class generator
 {
     friend function;
     friend computation;
+    friend communicator;
     friend buffer;
     friend cuda_ast::generator;
 
@@ -4921,6 +5730,19 @@ private:
 
     std::vector<tiramisu::expr> dims;
 
+    /**
+      * The number of elements and the stride (in elements) of each loop level
+      * collapsed with collapse_strided(), from the innermost to the outermost.
+      */
+    std::vector<std::pair<tiramisu::expr, tiramisu::expr>> strided_dims;
+
+    /**
+      * Return the differences between the elements of the buffer \p buff
+      * accessed by two consecutive iterations of the loop level \p level,
+      * or NULL if the communication does not access a single buffer.
+      */
+    isl_set *get_loop_level_access_deltas(int level, const tiramisu::buffer **buff);
+
 protected:
 
     xfer_prop prop;
@@ -4953,6 +5775,89 @@ public:
       */
     void collapse_many(std::vector<collapse_group> collapse_each);
 
+    /**
+      * \brief Collapse a loop level whose consecutive iterations are not contiguous in memory.
+      *
+      * \details Unlike collapse(), the elements transferred by consecutive
+      * iterations of the loop level \p level do not need to be contiguous:
+      * the communication is done in place using an MPI derived datatype
+      * (a vector of the elements transferred by one iteration), without
+      * packing the data in a staging buffer.  This is useful to send a
+      * column of a row-major 2D buffer or a face of a 3D buffer.
+      *
+      * The stride of the loop level is derived from the access relation of
+      * the communication (the access to the sent data for a send, the access
+      * relation of the received data for a recv) and from the sizes of the
+      * accessed buffer.  The second overload takes the stride (in number of
+      * elements) explicitly.
+      *
+      * The loop levels collapsed with collapse() should be inner to the loop
+      * levels collapsed with this function, and at most two loop levels can
+      * be collapsed with this function (e.g., a face of a 3D buffer).
+      *
+      * Example: to send the column j=0 of a buffer b[N][M],
+      *
+      * \code
+      * xfer col = computation::create_xfer("{s[q,i]: 0<=q<2 and 0<=i<N}", "{r[q,i]: 0<=q<2 and 0<=i<N}",
+      *                                     q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+      *                                     xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), b_comp(i, 0), &f);
+      * col.s->collapse_strided(1, 0, N);
+      * col.r->collapse_strided(1, 0, N);
+      * \endcode
+      *
+      * sends and receives the column in one message whose datatype has a
+      * stride of M elements.
+      */
+    // @{
+    void collapse_strided(int level, tiramisu::expr collapse_from_iter, tiramisu::expr num_collapsed);
+    void collapse_strided(int level, tiramisu::expr collapse_from_iter, tiramisu::expr num_collapsed,
+                          tiramisu::expr stride);
+    // @}
+
+    /**
+      * Return the stride (in number of elements) between the data accessed
+      * by two consecutive iterations of the loop level \p level.
+      */
+    tiramisu::expr get_loop_level_stride(int level);
+
+    /**
+      * Same as get_loop_level_stride(), but return false instead of failing
+      * if the stride is not a constant integer.
+      */
+    bool get_loop_level_constant_stride(int level, long &stride);
+
+    /**
+      * Return true if the loop level \p level iterates over an interval whose
+      * bounds are constant integers that do not depend on the other loop levels.
+      * The first iteration and the number of iterations are stored in
+      * \p lower_bound and \p extent.
+      */
+    bool get_loop_level_constant_bounds(int level, long &lower_bound, long &extent);
+
+    /**
+      * Return true if the iterator of the loop level \p level is used in \p e.
+      */
+    bool is_loop_level_used_in(int level, const tiramisu::expr &e);
+
+    /**
+      * Return true if some loop levels of this communication were collapsed.
+      */
+    bool is_collapsed() const;
+
+    /**
+      * Return the number of elements and the stride of the loop levels
+      * collapsed with collapse_strided().
+      */
+    const std::vector<std::pair<tiramisu::expr, tiramisu::expr>> &get_strided_dims() const;
+
+    /**
+      * Add the counts and the strides of the loop levels collapsed with
+      * collapse_strided() to the arguments of the library call, starting at
+      * the argument \p first_argument_idx, and call the strided variant of
+      * the MPI function.  Used when lifting the communication.
+      */
+    void add_strided_library_call_args(int first_argument_idx);
+
 };
 
 class send : public communicator {
@@ -4999,6 +5904,23 @@ public:
     void set_dest(tiramisu::expr dest);
 
     void override_msg_tag(tiramisu::expr msg_tag);
+
+    /**
+      * \brief Merge the fine-grained messages of this send and of its matching
+      * receive into larger messages.
+      *
+      * \details Starting from the innermost loop level, each loop level whose
+      * iterations all go to the same rank with the same tag, and that has
+      * constant bounds, is collapsed on both sides: with collapse() while
+      * the transferred data stays contiguous, then with collapse_strided()
+      * (for at most two loop levels) while it can be described with a strided
+      * MPI datatype (except for the one-sided communications, whose data
+      * should stay contiguous).  Only blocking communications that were not
+      * collapsed by hand are coalesced, and the loop levels that the send
+      * shares with its producer (see computation::is_fused_with()) are not
+      * collapsed.  Return the number of collapsed loop levels.
+      */
+    int coalesce();
 };
 
 class recv : public communicator {
@@ -5074,6 +5996,56 @@ public:
 
 };
 
+/**
+  * \brief A collective communication (MPI_Allreduce, MPI_Allgather, MPI_Bcast
+  * or MPI_Alltoall) executed by all the ranks.
+  *
+  * \details The collective operation is selected by one of the attributes
+  * ALLREDUCE, ALLGATHER, BCAST or ALLTOALL of \p prop.  The NONBLOCK attribute
+  * selects the non-blocking variant (e.g., MPI_Iallreduce); in that case a
+  * request buffer should be provided with set_wait_access() and the operation
+  * should be completed with a tiramisu::wait.
+  *
+  * \p rhs is an access to the first element of the data sent by each rank and
+  * \p dims gives the number of elements (the product of \p dims) sent by
+  * each rank (to each rank in the case of ALLTOALL).  Except for BCAST,
+  * which is executed in place on \p rhs, the result is stored using the access
+  * relation of the collective (set with set_access()), which should point
+  * to the first element of the receive buffer.
+  *
+  * \p reduction_op is the reduction operator of an ALLREDUCE (o_add, o_mul,
+  * o_max or o_min) and \p root is the rank that broadcasts its data in a BCAST.
+  *
+  * For example, the sum of the local dot products of all the ranks is computed
+  * as follows
+  *
+  * \code
+  * tiramisu::collective sum("{sum[0]}", dot(0), xfer_prop(p_float64, {MPI, BLOCK, ALLREDUCE}),
+  *                          {1}, &f);
+  * sum.set_access("{sum[i]->b_global_dot[i]}");
+  * \endcode
+  */
+class collective : public communicator {
+private:
+
+    tiramisu::op_t reduction_op;
+
+    tiramisu::expr root;
+
+public:
+
+    collective(std::string iteration_domain_str, tiramisu::expr rhs, xfer_prop prop,
+               std::vector<expr> dims, tiramisu::function *fct,
+               tiramisu::op_t reduction_op = tiramisu::o_add, tiramisu::expr root = tiramisu::expr(0));
+
+    virtual bool is_collective() const override;
+
+    tiramisu::op_t get_reduction_op() const;
+
+    tiramisu::expr get_root() const;
+
+};
+
 // Halide IR specific functions
 
 void halide_stmt_dump(Halide::Internal::Stmt s);
@@ -1,17 +1,35 @@
 #ifndef _H_DEBUG_
 #define _H_DEBUG_
 
+#include <atomic>
 #include <iostream>
+#include <string>
 
 /**
-  * Debugging level.
+  * Debugging level.  The debugging code of the levels above it is removed at
+  * compile time.  The levels actually printed are set at runtime (see
+  * tiramisu::get_debug_level()) and cannot exceed this level.
   */
+#ifndef DEBUG_LEVEL
 #define DEBUG_LEVEL 3
+#endif
 
 /**
-  * Set to 1 to enable debugging and 0 to disable debugging.
+  * Set to 1 to enable debugging and 0 to disable debugging.  When debugging
+  * is disabled, the debugging code is removed at compile time.
   */
+#ifndef ENABLE_DEBUG
 #define ENABLE_DEBUG true
+#endif
+
+/**
+  * The source file whose debugging level is used by the debugging macros.
+  */
+#ifdef __BASE_FILE__
+#define TIRAMISU_DEBUG_FILE __BASE_FILE__
+#else
+#define TIRAMISU_DEBUG_FILE __FILE__
+#endif
 
 namespace tiramisu
 {
@@ -23,31 +41,91 @@ void print_indentation();
 
 extern int tiramisu_indentation;
 
+/**
+  * Return the runtime debugging level of the module (the source file without
+  * its directory, its "tiramisu_" prefix and its extension, e.g. "core" or
+  * "codegen_halide") of the source file \p file.
+  *
+  * The levels are read from the environment variable TIRAMISU_DEBUG_LEVEL, a
+  * comma-separated list of a default level and of module=level pairs.  For
+  * example TIRAMISU_DEBUG_LEVEL=0,codegen_halide=10 only prints the debugging
+  * information of tiramisu_codegen_halide.cpp.  The default level is
+  * DEBUG_LEVEL.
+  */
+int get_debug_level(const char *file);
+
+/**
+  * Set the runtime debugging level of all the modules to \p level.
+  */
+void set_debug_level(int level);
+
+/**
+  * Set the runtime debugging level of the module \p module to \p level
+  * (see get_debug_level()).
+  */
+void set_debug_level(const std::string &module, int level);
+
+/**
+  * Incremented each time the runtime debugging levels change, so that the
+  * levels cached by the debugging macros are read again.
+  */
+extern std::atomic<int> debug_levels_version;
+
 } // namespace tiramisu
 
+namespace
+{
+
+/**
+  * Return the runtime debugging level of the source file that includes this
+  * header.  The level is cached: the debugging macros only compare two
+  * integers when the debugging level is not reached.
+  */
+inline int tiramisu_file_debug_level()
+{
+    static std::atomic<int> version(-1);
+    static std::atomic<int> level(0);
+    int current_version = tiramisu::debug_levels_version.load(std::memory_order_relaxed);
+    if (version.load(std::memory_order_relaxed) != current_version)
+    {
+        level.store(tiramisu::get_debug_level(TIRAMISU_DEBUG_FILE), std::memory_order_relaxed);
+        version.store(current_version, std::memory_order_relaxed);
+    }
+    return level.load(std::memory_order_relaxed);
+}
+
+}
+
+/**
+  * True if the debugging code of level \p LEVEL should run.  The arguments of
+  * the debugging macros are only evaluated in this case.
+  */
+#define DEBUG_ENABLED(LEVEL) \
+    (ENABLE_DEBUG && DEBUG_LEVEL>=(LEVEL) && tiramisu_file_debug_level()>=(LEVEL))
+
 /**
   * Print function name.
   */
 #define DEBUG_FCT_NAME(LEVEL) {                 \
-    if (ENABLE_DEBUG && DEBUG_LEVEL>=LEVEL) {   \
+    if (DEBUG_ENABLED(LEVEL)) {                 \
         tiramisu::print_indentation();          \
         tiramisu::str_dump("[");                \
         tiramisu::str_dump(__FUNCTION__);       \
         tiramisu::str_dump(" function]\n");     \
+        std::flush(std::cout);                  \
     }                                           \
-    std::flush(std::cout);                      \
 };
 
 /**
   * Run \p STMT if the debugging level is above \p LEVEL.
   */
 #define DEBUG(LEVEL, STMT) {                    \
-    if (ENABLE_DEBUG && DEBUG_LEVEL>=LEVEL) {   \
+    if (DEBUG_ENABLED(LEVEL)) {                 \
         tiramisu::print_indentation();          \
         STMT;                                   \
         tiramisu::str_dump("\n");               \
+        std::flush(std::cout);                  \
     }                                           \
-    std::flush(std::cout);                      \
 };
 
 /**
@@ -56,27 +134,27 @@ extern int tiramisu_indentation;
   * the end of DEBUG.
   */
 #define DEBUG_NO_NEWLINE(LEVEL, STMT) {         \
-    if (ENABLE_DEBUG && DEBUG_LEVEL>=LEVEL) {   \
+    if (DEBUG_ENABLED(LEVEL)) {                 \
         tiramisu::print_indentation();          \
         STMT;                                   \
+        std::flush(std::cout);                  \
     }                                           \
-    std::flush(std::cout);                      \
 };
 
 #define DEBUG_NO_NEWLINE_NO_INDENT(LEVEL, STMT) {         \
-    if (ENABLE_DEBUG && DEBUG_LEVEL>=LEVEL) {   \
+    if (DEBUG_ENABLED(LEVEL)) {                 \
         STMT;                                   \
+        std::flush(std::cout);                  \
     }                                           \
-    std::flush(std::cout);                      \
 };
 
 
 
 #define DEBUG_NEWLINE(LEVEL) {                  \
-    if (ENABLE_DEBUG && DEBUG_LEVEL>=LEVEL) {   \
+    if (DEBUG_ENABLED(LEVEL)) {                 \
         tiramisu::str_dump("\n");               \
+        std::flush(std::cout);                  \
     }                                           \
-    std::flush(std::cout);                      \
 };
 
 /**
@@ -66,6 +66,12 @@ private:
       */
     static function *implicit_fct;
 
+    /**
+      * Generate the isl AST of a function from a schedule tree
+      * instead of a flat union of schedule maps ?
+      */
+    static bool schedule_tree_codegen;
+
 public:
 
     /**
@@ -130,9 +136,31 @@ public:
     static void set_default_tiramisu_options()
     {
         global::loop_iterator_type = p_int32;
+        global::schedule_tree_codegen = false;
         set_auto_data_mapping(true);
     }
 
+    /**
+      * If this option is set to true, the isl AST of a function is
+      * generated from an isl schedule tree (sequence and band nodes)
+      * built from the schedules of its computations, instead of from
+      * the union of their schedules padded to the same number of
+      * dimensions.  The schedule tree only has a band for the loop levels
+      * that are really needed by each group of computations, which
+      * reduces AST generation time and the number of redundant guards
+      * in deep functions with many computations.  By default, the flat
+      * schedule maps are used.
+      */
+    static void set_schedule_tree_codegen(bool v)
+    {
+        global::schedule_tree_codegen = v;
+    }
+
+    static bool is_schedule_tree_codegen_set()
+    {
+        return global::schedule_tree_codegen;
+    }
+
     static void set_loop_iterator_type(primitive_t t) {
         global::loop_iterator_type = t;
     }
@@ -25,6 +25,27 @@ float *tiramisu_address_of_float32(halide_buffer_t *buffer, unsigned long index)
 
 double *tiramisu_address_of_float64(halide_buffer_t *buffer, unsigned long index);
 
+/**
+  * Map the file \p file_name (created or extended to \p size bytes if
+  * needed) in memory, and unmap it.  Used for the buffers mapped from a file
+  * (see buffer::set_storage_file()).  tiramisu_mmap_buffer() returns NULL
+  * if the file cannot be mapped.
+  */
+void *tiramisu_mmap_buffer(const char *file_name, int64_t size);
+int tiramisu_munmap_buffer(void *buffer, int64_t size);
+
+/**
+  * Ask a helper thread to read the tile \p tile + 1 of the buffer \p base
+  * (of \p buffer_bytes bytes, divided in tiles of \p tile_bytes bytes) in
+  * and to write the tile \p tile - 1 out (see computation::stream()).
+  * tiramisu_stream_wait() waits until the helper thread has processed
+  * all the requests.
+  */
+int tiramisu_stream_tile(void *base, int64_t buffer_bytes, int64_t tile_bytes, int32_t tile);
+int tiramisu_stream_wait();
+
+halide_buffer_t *tiramisu_batch_get_buffer(void *buffers, int32_t index);
+
 #ifdef WITH_MPI
 void *tiramisu_address_of_wait(halide_buffer_t *buffer, unsigned long index);
 #endif
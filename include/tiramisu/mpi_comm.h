@@ -5,15 +5,90 @@
 #include <mpi.h>
 
 int tiramisu_MPI_init();
+
+/**
+  * Initialize MPI with the thread support level \p thread_level (e.g.,
+  * MPI_THREAD_FUNNELED or MPI_THREAD_MULTIPLE) and return the rank.
+  */
+int tiramisu_MPI_init(int thread_level);
+
+/**
+  * Initialize MPI for hybrid MPI + threads execution (typically one rank per
+  * socket, with parallel loops inside each rank): MPI is initialized with
+  * MPI_THREAD_MULTIPLE and a progress thread is started so that the
+  * non-blocking communications progress while the worker threads compute.
+  */
+int tiramisu_MPI_init_hybrid();
+
+/**
+  * Start (resp. stop) the thread that polls MPI to make the communications
+  * progress.  MPI should be initialized with MPI_THREAD_MULTIPLE.  The
+  * progress thread is stopped by tiramisu_MPI_cleanup().
+  */
+// @{
+void tiramisu_MPI_start_progress_thread();
+void tiramisu_MPI_stop_progress_thread();
+// @}
+
 void tiramisu_MPI_cleanup();
 void tiramisu_MPI_global_barrier();
 
+/**
+  * Reset the communication time accumulated by this rank.
+  */
+void tiramisu_MPI_reset_comm_time();
+
+/**
+  * Return the time (in milliseconds) this rank spent inside MPI communication calls
+  * (sends, receives, waits and collectives) since the last tiramisu_MPI_reset_comm_time().
+  */
+double tiramisu_MPI_get_comm_time();
+
+/**
+  * Gather on rank 0 and print, for every rank, its total time \p total_time, its
+  * communication time \p comm_time and its compute time (total minus communication).
+  * Times are in milliseconds. Collective: must be called by all the ranks.
+  */
+void tiramisu_MPI_print_rank_times(const char *kernel_name, double total_time, double comm_time);
+
 extern "C" {
 
 inline void check_MPI_error(int ret_val);
 
 int tiramisu_MPI_Comm_rank(int offset);
 
+/**
+  * Exit with an error if MPI was not initialized with MPI_THREAD_MULTIPLE.
+  * Called at the beginning of the functions that communicate from parallel loops.
+  */
+void tiramisu_MPI_check_thread_multiple();
+
+/**
+  * One-sided (RMA) communications.  tiramisu_MPI_Win_create() exposes the
+  * \p size bytes at \p base as the window \p window the first time it is
+  * called (it is collective); the later calls only check that the window
+  * still exposes the same buffer.  The windows are freed by tiramisu_MPI_cleanup().
+  * tiramisu_MPI_Put_<type>() writes \p count elements at \p displacement
+  * (in elements) in the window of \p dest.  The puts are issued between two
+  * calls to tiramisu_MPI_Win_fence(), which all the ranks execute: the data
+  * is in the windows of the targets when the second fence returns, so the
+  * targets need neither the senders nor the number of messages.
+  */
+// @{
+void tiramisu_MPI_Win_create(int window, void *base, long size, int element_size);
+void tiramisu_MPI_Win_fence(int window);
+void tiramisu_MPI_Put_int8(int count, int dest, int window, char *data, long displacement);
+void tiramisu_MPI_Put_int16(int count, int dest, int window, short *data, long displacement);
+void tiramisu_MPI_Put_int32(int count, int dest, int window, int *data, long displacement);
+void tiramisu_MPI_Put_int64(int count, int dest, int window, long *data, long displacement);
+void tiramisu_MPI_Put_uint8(int count, int dest, int window, unsigned char *data, long displacement);
+void tiramisu_MPI_Put_uint16(int count, int dest, int window, unsigned short *data, long displacement);
+void tiramisu_MPI_Put_uint32(int count, int dest, int window, unsigned int *data, long displacement);
+void tiramisu_MPI_Put_uint64(int count, int dest, int window, unsigned long *data, long displacement);
+void tiramisu_MPI_Put_f32(int count, int dest, int window, float *data, long displacement);
+void tiramisu_MPI_Put_f64(int count, int dest, int window, double *data, long displacement);
+// @}
+
 void tiramisu_MPI_Wait(void *request);
 
 void tiramisu_MPI_Send(int count, int dest, int tag, char *data, MPI_Datatype type);
@@ -88,6 +163,263 @@ void tiramisu_MPI_Irecv_uint64(int count, int source, int tag, unsigned long *st
 void tiramisu_MPI_Irecv_f32(int count, int source, int tag, float *store_in, long *reqs);
 void tiramisu_MPI_Irecv_f64(int count, int source, int tag, double *store_in, long *reqs);
 
+MPI_Datatype tiramisu_MPI_create_strided_type(int count, int count0, int stride0, int count1, int stride1,
+                                 MPI_Datatype element_type, int element_size);
+
+void tiramisu_MPI_Send_strided_int8(int count, int dest, int tag, char *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_int16(int count, int dest, int tag, short *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_int32(int count, int dest, int tag, int *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_int64(int count, int dest, int tag, long *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_uint8(int count, int dest, int tag, unsigned char *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_uint16(int count, int dest, int tag, unsigned short *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_uint32(int count, int dest, int tag, unsigned int *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_uint64(int count, int dest, int tag, unsigned long *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_f32(int count, int dest, int tag, float *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Send_strided_f64(int count, int dest, int tag, double *data, int count0, int stride0, int count1, int stride1);
+
+void tiramisu_MPI_Ssend_strided_int8(int count, int dest, int tag, char *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_int16(int count, int dest, int tag, short *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_int32(int count, int dest, int tag, int *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_int64(int count, int dest, int tag, long *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_uint8(int count, int dest, int tag, unsigned char *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_uint16(int count, int dest, int tag, unsigned short *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_uint32(int count, int dest, int tag, unsigned int *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_uint64(int count, int dest, int tag, unsigned long *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_f32(int count, int dest, int tag, float *data, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Ssend_strided_f64(int count, int dest, int tag, double *data, int count0, int stride0, int count1, int stride1);
+
+void tiramisu_MPI_Isend_strided_int8(int count, int dest, int tag, char *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_int16(int count, int dest, int tag, short *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_int32(int count, int dest, int tag, int *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_int64(int count, int dest, int tag, long *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_uint8(int count, int dest, int tag, unsigned char *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_uint16(int count, int dest, int tag, unsigned short *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_uint32(int count, int dest, int tag, unsigned int *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_uint64(int count, int dest, int tag, unsigned long *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_f32(int count, int dest, int tag, float *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Isend_strided_f64(int count, int dest, int tag, double *data, long *reqs, int count0, int stride0, int count1, int stride1);
+
+void tiramisu_MPI_Issend_strided_int8(int count, int dest, int tag, char *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_int16(int count, int dest, int tag, short *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_int32(int count, int dest, int tag, int *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_int64(int count, int dest, int tag, long *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_uint8(int count, int dest, int tag, unsigned char *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_uint16(int count, int dest, int tag, unsigned short *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_uint32(int count, int dest, int tag, unsigned int *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_uint64(int count, int dest, int tag, unsigned long *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_f32(int count, int dest, int tag, float *data, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Issend_strided_f64(int count, int dest, int tag, double *data, long *reqs, int count0, int stride0, int count1, int stride1);
+
+void tiramisu_MPI_Recv_strided_int8(int count, int source, int tag, char *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_int16(int count, int source, int tag, short *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_int32(int count, int source, int tag, int *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_int64(int count, int source, int tag, long *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_uint8(int count, int source, int tag, unsigned char *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_uint16(int count, int source, int tag, unsigned short *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_uint32(int count, int source, int tag, unsigned int *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_uint64(int count, int source, int tag, unsigned long *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_f32(int count, int source, int tag, float *store_in, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Recv_strided_f64(int count, int source, int tag, double *store_in, int count0, int stride0, int count1, int stride1);
+
+void tiramisu_MPI_Irecv_strided_int8(int count, int source, int tag, char *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_int16(int count, int source, int tag, short *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_int32(int count, int source, int tag, int *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_int64(int count, int source, int tag, long *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_uint8(int count, int source, int tag, unsigned char *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_uint16(int count, int source, int tag, unsigned short *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_uint32(int count, int source, int tag, unsigned int *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_uint64(int count, int source, int tag, unsigned long *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_f32(int count, int source, int tag, float *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+void tiramisu_MPI_Irecv_strided_f64(int count, int source, int tag, double *store_in, long *reqs, int count0, int stride0, int count1, int stride1);
+
+// Persistent communications: the request is created by the first call and restarted by the next ones.
+void tiramisu_MPI_Psend_int8(int count, int dest, int tag, char *data, long *reqs);
+void tiramisu_MPI_Psend_int16(int count, int dest, int tag, short *data, long *reqs);
+void tiramisu_MPI_Psend_int32(int count, int dest, int tag, int *data, long *reqs);
+void tiramisu_MPI_Psend_int64(int count, int dest, int tag, long *data, long *reqs);
+void tiramisu_MPI_Psend_uint8(int count, int dest, int tag, unsigned char *data, long *reqs);
+void tiramisu_MPI_Psend_uint16(int count, int dest, int tag, unsigned short *data, long *reqs);
+void tiramisu_MPI_Psend_uint32(int count, int dest, int tag, unsigned int *data, long *reqs);
+void tiramisu_MPI_Psend_uint64(int count, int dest, int tag, unsigned long *data, long *reqs);
+void tiramisu_MPI_Psend_f32(int count, int dest, int tag, float *data, long *reqs);
+void tiramisu_MPI_Psend_f64(int count, int dest, int tag, double *data, long *reqs);
+
+void tiramisu_MPI_Pssend_int8(int count, int dest, int tag, char *data, long *reqs);
+void tiramisu_MPI_Pssend_int16(int count, int dest, int tag, short *data, long *reqs);
+void tiramisu_MPI_Pssend_int32(int count, int dest, int tag, int *data, long *reqs);
+void tiramisu_MPI_Pssend_int64(int count, int dest, int tag, long *data, long *reqs);
+void tiramisu_MPI_Pssend_uint8(int count, int dest, int tag, unsigned char *data, long *reqs);
+void tiramisu_MPI_Pssend_uint16(int count, int dest, int tag, unsigned short *data, long *reqs);
+void tiramisu_MPI_Pssend_uint32(int count, int dest, int tag, unsigned int *data, long *reqs);
+void tiramisu_MPI_Pssend_uint64(int count, int dest, int tag, unsigned long *data, long *reqs);
+void tiramisu_MPI_Pssend_f32(int count, int dest, int tag, float *data, long *reqs);
+void tiramisu_MPI_Pssend_f64(int count, int dest, int tag, double *data, long *reqs);
+
+void tiramisu_MPI_Precv_int8(int count, int source, int tag, char *store_in, long *reqs);
+void tiramisu_MPI_Precv_int16(int count, int source, int tag, short *store_in, long *reqs);
+void tiramisu_MPI_Precv_int32(int count, int source, int tag, int *store_in, long *reqs);
+void tiramisu_MPI_Precv_int64(int count, int source, int tag, long *store_in, long *reqs);
+void tiramisu_MPI_Precv_uint8(int count, int source, int tag, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Precv_uint16(int count, int source, int tag, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Precv_uint32(int count, int source, int tag, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Precv_uint64(int count, int source, int tag, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Precv_f32(int count, int source, int tag, float *store_in, long *reqs);
+void tiramisu_MPI_Precv_f64(int count, int source, int tag, double *store_in, long *reqs);
+
+void tiramisu_MPI_Allreduce_sum_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_sum_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_sum_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_sum_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_sum_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_sum_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_sum_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_sum_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_sum_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_sum_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Allreduce_prod_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_prod_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_prod_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_prod_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_prod_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_prod_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_prod_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_prod_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_prod_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_prod_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Allreduce_max_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_max_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_max_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_max_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_max_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_max_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_max_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_max_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_max_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_max_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Allreduce_min_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_min_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_min_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_min_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_min_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_min_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_min_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_min_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_min_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_min_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Iallreduce_sum_int8(int count, char *data, char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_int16(int count, short *data, short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_int32(int count, int *data, int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_int64(int count, long *data, long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_uint8(int count, unsigned char *data, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_uint16(int count, unsigned short *data, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_uint32(int count, unsigned int *data, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_uint64(int count, unsigned long *data, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_f32(int count, float *data, float *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_sum_f64(int count, double *data, double *store_in, long *reqs);
+
+void tiramisu_MPI_Iallreduce_prod_int8(int count, char *data, char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_int16(int count, short *data, short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_int32(int count, int *data, int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_int64(int count, long *data, long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_uint8(int count, unsigned char *data, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_uint16(int count, unsigned short *data, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_uint32(int count, unsigned int *data, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_uint64(int count, unsigned long *data, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_f32(int count, float *data, float *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_prod_f64(int count, double *data, double *store_in, long *reqs);
+
+void tiramisu_MPI_Iallreduce_max_int8(int count, char *data, char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_int16(int count, short *data, short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_int32(int count, int *data, int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_int64(int count, long *data, long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_uint8(int count, unsigned char *data, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_uint16(int count, unsigned short *data, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_uint32(int count, unsigned int *data, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_uint64(int count, unsigned long *data, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_f32(int count, float *data, float *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_max_f64(int count, double *data, double *store_in, long *reqs);
+
+void tiramisu_MPI_Iallreduce_min_int8(int count, char *data, char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_int16(int count, short *data, short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_int32(int count, int *data, int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_int64(int count, long *data, long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_uint8(int count, unsigned char *data, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_uint16(int count, unsigned short *data, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_uint32(int count, unsigned int *data, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_uint64(int count, unsigned long *data, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_f32(int count, float *data, float *store_in, long *reqs);
+void tiramisu_MPI_Iallreduce_min_f64(int count, double *data, double *store_in, long *reqs);
+
+void tiramisu_MPI_Allgather_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allgather_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allgather_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allgather_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allgather_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allgather_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allgather_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allgather_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allgather_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allgather_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Iallgather_int8(int count, char *data, char *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_int16(int count, short *data, short *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_int32(int count, int *data, int *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_int64(int count, long *data, long *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_uint8(int count, unsigned char *data, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_uint16(int count, unsigned short *data, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_uint32(int count, unsigned int *data, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_uint64(int count, unsigned long *data, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_f32(int count, float *data, float *store_in, long *reqs);
+void tiramisu_MPI_Iallgather_f64(int count, double *data, double *store_in, long *reqs);
+
+void tiramisu_MPI_Alltoall_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Alltoall_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Alltoall_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Alltoall_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Alltoall_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Alltoall_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Alltoall_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Alltoall_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Alltoall_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Alltoall_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Ialltoall_int8(int count, char *data, char *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_int16(int count, short *data, short *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_int32(int count, int *data, int *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_int64(int count, long *data, long *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_uint8(int count, unsigned char *data, unsigned char *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_uint16(int count, unsigned short *data, unsigned short *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_uint32(int count, unsigned int *data, unsigned int *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_uint64(int count, unsigned long *data, unsigned long *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_f32(int count, float *data, float *store_in, long *reqs);
+void tiramisu_MPI_Ialltoall_f64(int count, double *data, double *store_in, long *reqs);
+
+void tiramisu_MPI_Bcast_int8(int count, int root, char *data);
+void tiramisu_MPI_Bcast_int16(int count, int root, short *data);
+void tiramisu_MPI_Bcast_int32(int count, int root, int *data);
+void tiramisu_MPI_Bcast_int64(int count, int root, long *data);
+void tiramisu_MPI_Bcast_uint8(int count, int root, unsigned char *data);
+void tiramisu_MPI_Bcast_uint16(int count, int root, unsigned short *data);
+void tiramisu_MPI_Bcast_uint32(int count, int root, unsigned int *data);
+void tiramisu_MPI_Bcast_uint64(int count, int root, unsigned long *data);
+void tiramisu_MPI_Bcast_f32(int count, int root, float *data);
+void tiramisu_MPI_Bcast_f64(int count, int root, double *data);
+
+void tiramisu_MPI_Ibcast_int8(int count, int root, char *data, long *reqs);
+void tiramisu_MPI_Ibcast_int16(int count, int root, short *data, long *reqs);
+void tiramisu_MPI_Ibcast_int32(int count, int root, int *data, long *reqs);
+void tiramisu_MPI_Ibcast_int64(int count, int root, long *data, long *reqs);
+void tiramisu_MPI_Ibcast_uint8(int count, int root, unsigned char *data, long *reqs);
+void tiramisu_MPI_Ibcast_uint16(int count, int root, unsigned short *data, long *reqs);
+void tiramisu_MPI_Ibcast_uint32(int count, int root, unsigned int *data, long *reqs);
+void tiramisu_MPI_Ibcast_uint64(int count, int root, unsigned long *data, long *reqs);
+void tiramisu_MPI_Ibcast_f32(int count, int root, float *data, long *reqs);
+void tiramisu_MPI_Ibcast_f64(int count, int root, double *data, long *reqs);
+
 }
 #endif
 #endif
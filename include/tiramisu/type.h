@@ -138,6 +138,31 @@ enum argument_t
     a_temporary
 };
 
+/**
+  * Orders in which the ranks of a process grid are numbered.
+  * "l_" stands for layout.
+  */
+enum layout_t
+{
+    l_row_major,
+    l_column_major
+};
+
+/**
+  * Types of the loops generated by the isl AST generator for a loop level.
+  * "ast_loop_" stands for AST loop.
+  * ast_loop_atomic generates a single loop with min/max bounds,
+  * ast_loop_unroll completely unrolls the loop and ast_loop_separate
+  * separates the full iterations (e.g. full tiles) from the partial ones.
+  */
+enum ast_loop_t
+{
+    ast_loop_default,
+    ast_loop_atomic,
+    ast_loop_unroll,
+    ast_loop_separate
+};
+
 /**
   * Types of ranks in a distributed communication
   * "r_" stands for rank.
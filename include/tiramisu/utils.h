@@ -249,6 +249,127 @@ inline void init_2D_buffer_interleaving(Halide::Buffer<T> &buf, T val1, T val2)
     }
 }
 
+/**
+ * Access pattern hint given to the OS when a buffer file is mapped
+ * (see mapped_buffer).
+ */
+enum buffer_file_access_t
+{
+    buffer_file_normal,
+    buffer_file_sequential,
+    buffer_file_random,
+    buffer_file_willneed
+};
+
+/**
+ * Buffer files use a simple raw format: a header giving the element
+ * type and the extent of each dimension (in Halide order, the innermost
+ * dimension first), followed by the dense data.  The data starts at a
+ * page aligned offset so that it can be mapped and used in place.
+ *
+ * Write \p size_bytes bytes of dense data from \p data into the buffer
+ * file \p file_name.
+ */
+void save_buffer_file(const std::string &file_name, halide_type_t type,
+                      const std::vector<int> &sizes, const void *data,
+                      size_t size_bytes);
+
+/**
+ * Map the buffer file \p file_name in memory and check that its
+ * elements have the type \p type.  The mapping is private: writes to the
+ * buffer are not written back to the file.
+ * Return the address of the mapping, set \p data to the address of the
+ * first element, \p sizes to the extents of the buffer and
+ * \p mapping_size to the size of the mapping.
+ * \p access is given to the OS as a hint.  If \p huge_pages is true,
+ * the OS is asked to back the mapping with transparent huge pages.
+ */
+void *map_buffer_file(const std::string &file_name, halide_type_t type,
+                      buffer_file_access_t access, bool huge_pages,
+                      void **data, std::vector<int> &sizes,
+                      size_t &mapping_size);
+
+/**
+ * Unmap a mapping returned by map_buffer_file().
+ */
+void unmap_buffer_file(void *mapping, size_t mapping_size);
+
+/**
+ * Write the buffer \p buf into the buffer file \p file_name.
+ * \p buf can have any number of dimensions and nonzero mins (only the
+ * extents are stored in the file).
+ */
+template<typename T>
+inline void save_buffer(const Halide::Buffer<T> &buf, const std::string &file_name)
+{
+    std::vector<int> sizes, mins;
+    for (int i = 0; i < buf.dimensions(); i++)
+    {
+        sizes.push_back(buf.dim(i).extent());
+        mins.push_back(buf.dim(i).min());
+    }
+
+    // Make a dense copy so that the data can be written in one block.
+    // copy_from() copies the intersection of the two buffers, so the copy
+    // has the same mins as buf.
+    Halide::Buffer<T> dense(sizes);
+    dense.set_min(mins);
+    dense.copy_from(buf);
+
+    save_buffer_file(file_name, halide_type_of<T>(), sizes, dense.data(),
+                     dense.size_in_bytes());
+}
+
+/**
+ * A Halide buffer whose data is a buffer file mapped in memory.
+ * The data is neither copied nor initialized element by element: pages
+ * are loaded by the OS on first access.  The file is unmapped when the
+ * mapped_buffer is destroyed.
+ *
+ * The raw buffer can be passed directly to a generated function as one
+ * of its inputs:
+ *
+ * \code
+ * mapped_buffer<float> weights("weights.bin");
+ * tiramisu_generated_code(weights.raw_buffer(), output.raw_buffer());
+ * \endcode
+ */
+template<typename T>
+class mapped_buffer
+{
+    void *mapping;
+    size_t mapping_size;
+
+public:
+    Halide::Buffer<T> buffer;
+
+    mapped_buffer(const std::string &file_name,
+                  buffer_file_access_t access = buffer_file_sequential,
+                  bool huge_pages = false)
+    {
+        void *data;
+        std::vector<int> sizes;
+        mapping = map_buffer_file(file_name, halide_type_of<T>(), access,
+                                  huge_pages, &data, sizes, mapping_size);
+        buffer = Halide::Buffer<T>((T *) data, sizes);
+    }
+
+    mapped_buffer(const mapped_buffer &) = delete;
+    mapped_buffer &operator=(const mapped_buffer &) = delete;
+
+    ~mapped_buffer()
+    {
+        // Release the buffer before the memory it points to.
+        buffer = Halide::Buffer<T>();
+        unmap_buffer_file(mapping, mapping_size);
+    }
+
+    halide_buffer_t *raw_buffer()
+    {
+        return buffer.raw_buffer();
+    }
+};
+
 class tiramisu_timer
 {
 public:
@@ -158,7 +158,7 @@ isl_map *create_map_from_domain_and_range(isl_set *domain, isl_set *range)
 }
 
 isl_ast_expr *create_isl_ast_index_expression(isl_ast_build *build,
-                                              isl_map *access, int remove_level = -1)
+                                              isl_map *access, std::vector<int> remove_levels = {})
 {
     DEBUG_FCT_NAME(3);
     DEBUG_INDENT(4);
@@ -166,7 +166,7 @@ isl_ast_expr *create_isl_ast_index_expression(isl_ast_build *build,
     isl_map *schedule = isl_map_from_union_map(isl_ast_build_get_schedule(build));
     DEBUG(3, tiramisu::str_dump("Schedule:", isl_map_to_str(schedule)));
 
-    if (remove_level != -1) {
+    for (int remove_level : remove_levels) {
         DEBUG(3, tiramisu::str_dump("Dropping this level from the index computation :" + std::to_string(remove_level)));
         int dim_idx = loop_level_into_dynamic_dimension(remove_level) - 1; // subtract 1 b/c this includes the duplicate dim
         std::string sched_str = isl_map_to_str(schedule);
@@ -175,6 +175,7 @@ isl_ast_expr *create_isl_ast_index_expression(isl_ast_build *build,
         std::vector<std::string> parts;
         split_string(sched_str, "}", parts);
         sched_str = parts[0] + new_constraint;
+        isl_map_free(schedule);
         schedule = isl_map_read_from_str(isl_ast_build_get_ctx(build), sched_str.c_str());
     }
 
@@ -1258,7 +1259,7 @@ std::map<std::string, isl_ast_expr *> generator::compute_iterators_map(tiramisu:
 
     DEBUG(3, tiramisu::str_dump("Creating an isl_ast_index_expression for the access :",
                                 isl_map_to_str(identity)));
-    isl_ast_expr *idx_expr = create_isl_ast_index_expression(build, identity, comp->get_level_to_drop());
+    isl_ast_expr *idx_expr = create_isl_ast_index_expression(build, identity, comp->get_levels_to_drop());
     DEBUG(3, tiramisu::str_dump("The created isl_ast_expr expression for the index expression is :",
                                 isl_ast_expr_to_str(idx_expr)));
 
@@ -1344,10 +1345,21 @@ isl_ast_node *generator::stmt_code_generator(isl_ast_node *node, isl_ast_build *
         }
 
         if (req_access) {
-            comp->wait_index_expr = create_isl_ast_index_expression(build, req_access, comp->get_level_to_drop());
+            comp->wait_index_expr = create_isl_ast_index_expression(build, req_access, comp->get_levels_to_drop());
             isl_map_free(req_access);
         }
 
+        // A one-sided send also accesses the buffer of the receiver.
+        if (comp->rma_access_map) {
+            // The send itself has no access: use the one of the receiver for the time of the call.
+            isl_map *send_access = comp->access;
+            comp->access = comp->rma_access_map;
+            isl_map *target_access = comp->get_access_relation_adapted_to_time_processor_domain();
+            comp->access = send_access;
+            comp->rma_index_expr = create_isl_ast_index_expression(build, target_access, comp->get_levels_to_drop());
+            isl_map_free(target_access);
+        }
+
         /*
          * Compute the iterators map.
          * The iterators map is map between the original names of the iterators of a computation
@@ -1395,7 +1407,7 @@ isl_ast_node *generator::stmt_code_generator(isl_ast_node *node, isl_ast_build *
                     {
                         DEBUG(3, tiramisu::str_dump("Creating an isl_ast_index_expression for the access (isl_map *):",
                                                     isl_map_to_str(accesses[i])));
-                        isl_ast_expr *idx_expr = create_isl_ast_index_expression(build, accesses[i], comp->get_level_to_drop());
+                        isl_ast_expr *idx_expr = create_isl_ast_index_expression(build, accesses[i], comp->get_levels_to_drop());
                         DEBUG(3, tiramisu::str_dump("The created isl_ast_expr expression for the index expression is :", isl_ast_expr_to_str(idx_expr)));
                         index_expressions.push_back(idx_expr);
                         isl_map_free(accesses[i]);
@@ -2045,10 +2057,68 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
             Halide::Internal::ForType fortype = Halide::Internal::ForType::Serial;
             Halide::DeviceAPI dev_api = Halide::DeviceAPI::Host;
 
+            // Stream the buffers of the computations tagged at this level:
+            // each iteration starts reading the next tile in and writing
+            // the previous tile out on a helper thread.
+            std::vector<std::string> streamed_stmts;
+            for (auto &ts : tagged_stmts)
+            {
+                if ((ts.second == "stream") && fct.should_stream(ts.first, level))
+                {
+                    if (std::find(streamed_stmts.begin(), streamed_stmts.end(), ts.first) == streamed_stmts.end())
+                        streamed_stmts.push_back(ts.first);
+                    ts.first = "";
+                }
+            }
+            for (const auto &stmt_name : streamed_stmts)
+                for (const auto &sd : fct.stream_dimensions)
+                    if ((std::get<0>(sd) == stmt_name) && (std::get<1>(sd) == level))
+                        for (auto buf : std::get<2>(sd))
+                        {
+                            std::vector<isl_ast_expr *> ie = {};
+                            Halide::Type type = halide_type_from_tiramisu_type(buf->get_elements_type());
+                            Halide::Expr row_bytes = Halide::Expr((int64_t) type.bytes());
+                            for (size_t d = 1; d < buf->get_dim_sizes().size(); d++)
+                                row_bytes = row_bytes * Halide::cast(Halide::Int(64),
+                                        generator::halide_expr_from_tiramisu_expr(&fct, ie, buf->get_dim_sizes()[d]));
+                            Halide::Expr buffer_bytes = row_bytes * Halide::cast(Halide::Int(64),
+                                    generator::halide_expr_from_tiramisu_expr(&fct, ie, buf->get_dim_sizes()[0]));
+                            Halide::Expr tile_bytes = row_bytes * Halide::Expr((int64_t) std::get<3>(sd));
+
+                            Halide::Expr base;
+                            if (buf->get_argument_type() == tiramisu::a_temporary)
+                            {
+                                base = Halide::Internal::Variable::make(Halide::Handle(), buf->get_name());
+                            }
+                            else
+                            {
+                                base = Halide::Internal::Variable::make(Halide::type_of<struct halide_buffer_t *>(),
+                                                                        buf->get_name() + ".buffer");
+                                base = Halide::Internal::Call::make(Halide::Handle(1, type.handle_type),
+                                                                    "tiramisu_address_of_" +
+                                                                    str_from_tiramisu_type_primitive(buf->get_elements_type()),
+                                                                    {base, Halide::Expr(0)},
+                                                                    Halide::Internal::Call::Extern);
+                            }
+
+                            // The outer loop of the split iterates over the tiles: tile t
+                            // starts at the row t * rows of the buffer.
+                            Halide::Expr tile = Halide::cast(Halide::Int(32),
+                                    Halide::Internal::Variable::make(
+                                        halide_type_from_tiramisu_type(global::get_loop_iterator_data_type()),
+                                        iterator_str));
+                            Halide::Internal::Stmt stream_call = Halide::Internal::Evaluate::make(
+                                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_stream_tile",
+                                                                 {base, buffer_bytes, tile_bytes, tile},
+                                                                 Halide::Internal::Call::Extern));
+                            halide_body = Halide::Internal::Block::make(stream_call, halide_body);
+                        }
+
             // Change the type from Serial to parallel or vector if the
             // current level was marked as such.
             size_t tt = 0;
             bool convert_to_conditional = false;
+            int grid_dimension = -1;
             while (tt < tagged_stmts.size()) {
                 if (tagged_stmts[tt].first != "") {
                     if (tagged_stmts[tt].second == "parallelize" &&
@@ -2196,6 +2266,7 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                                fct.should_distribute(tagged_stmts[tt].first, level)) {
                         // Change this loop into an if statement instead
                         convert_to_conditional = true;
+                        grid_dimension = fct.get_distributed_grid_dimension(tagged_stmts[tt].first, level);
                         tagged_stmts[tt].first = "";
                         break;
                     }
@@ -2212,6 +2283,14 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                 Halide::Expr rank_var =
                         Halide::Internal::Variable::make(
                                 halide_type_from_tiramisu_type(global::get_loop_iterator_data_type()), "rank");
+                if (grid_dimension != -1)
+                {
+                    // The loop is distributed on a dimension of the process grid:
+                    // use the coordinate of the rank along that dimension.
+                    const std::vector<int> &grid = fct.get_process_grid();
+                    int stride = fct.get_process_grid_stride(grid_dimension);
+                    rank_var = (rank_var / stride) % grid[grid_dimension];
+                }
                 Halide::Expr condition = rank_var >= init_expr;
                 condition = condition && (rank_var < cond_upper_bound_halide_format);
                 Halide::Internal::Stmt else_s;
@@ -2223,6 +2302,14 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                 result = Halide::Internal::For::make(iterator_str, init_expr,
                                                      cond_upper_bound_halide_format - init_expr,
                                                      fortype, dev_api, halide_body);
+                if (!streamed_stmts.empty())
+                {
+                    // The buffers should not be accessed by the helper
+                    // thread after the loop (e.g. after they are freed).
+                    result = Halide::Internal::Block::make(result, Halide::Internal::Evaluate::make(
+                            Halide::Internal::Call::make(Halide::Int(32), "tiramisu_stream_wait", {},
+                                                         Halide::Internal::Call::Extern)));
+                }
                 DEBUG(3, tiramisu::str_dump("For loop created."));
                 DEBUG(10, std::cout << result);
             }
@@ -2282,6 +2369,8 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                     tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "unroll"));
                 if (fct.should_distribute(computation_name, l))
                     tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "distribute"));
+                if (fct.should_stream(computation_name, l))
+                    tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "stream"));
 
                 DEBUG(10, tiramisu::str_dump("The full list of tagged statements is now"));
                 for (const auto &ts: tagged_stmts)
@@ -2422,11 +2511,68 @@ void function::gen_halide_stmt()
     std::vector<std::pair<std::string, std::string>> generated_stmts;
     Halide::Internal::Stmt stmt;
 
+    // Generate the statements of the versions of the function.  They are
+    // visited in the reverse order of the generation of their ASTs
+    // (see gen_isl_ast()).
+    std::vector<Halide::Internal::Stmt> version_stmts(this->version_asts.size());
+    for (int v = this->version_asts.size() - 1; v >= 0; v--)
+    {
+        version_stmts[v] = tiramisu::generator::halide_stmt_from_isl_node(*this, this->version_asts[v].second, 0,
+                                                                          generated_stmts, false);
+
+        // Constant-fold the parameters of the specialized versions.
+        for (const auto &value : this->version_bindings[v])
+        {
+            Halide::Type type = halide_type_from_tiramisu_type(global::get_loop_iterator_data_type());
+            for (const auto &param : this->get_invariants())
+                if (param.get_name() == value.first)
+                {
+                    std::vector<isl_ast_expr *> ie = {};
+                    type = generator::halide_expr_from_tiramisu_expr(this, ie, param.get_expr()).type();
+                }
+            version_stmts[v] = Halide::Internal::substitute(value.first, Halide::cast(type, value.second),
+                                                            version_stmts[v]);
+        }
+    }
+
     // Generate the statement that represents the whole function
     stmt = tiramisu::generator::halide_stmt_from_isl_node(*this, this->get_isl_ast(), 0, generated_stmts, false);
 
+    // Execute the first version whose condition holds, otherwise the generic code.
+    for (int v = this->version_asts.size() - 1; v >= 0; v--)
+    {
+        Halide::Expr guard = halide_expr_from_isl_ast_expr(this->version_asts[v].first);
+        stmt = Halide::Internal::IfThenElse::make(guard, version_stmts[v], stmt);
+    }
+
     DEBUG(3, tiramisu::str_dump("The following Halide statement was generated:\n"); std::cout << stmt << std::endl);
 
+    // Expose the buffers written by one-sided communications.  All the ranks execute these
+    // calls: the windows are created (collectively) by the first call of the function only,
+    // and freed by tiramisu_MPI_cleanup().
+    for (int id = this->rma_windows.size() - 1; id >= 0; id--)
+    {
+        tiramisu::buffer *buf = this->rma_windows[id];
+        Halide::Expr size = Halide::Expr(halide_type_from_tiramisu_type(buf->get_elements_type()).bytes());
+        for (const auto &sz : buf->get_dim_sizes())
+        {
+            std::vector<isl_ast_expr *> ie = {};
+            size = size * generator::halide_expr_from_tiramisu_expr(this, ie, sz);
+        }
+        Halide::Type type = halide_type_from_tiramisu_type(buf->get_elements_type());
+        Halide::Expr base = Halide::Internal::Variable::make(Halide::type_of<struct halide_buffer_t *>(),
+                                                             buf->get_name() + ".buffer");
+        base = Halide::Internal::Call::make(Halide::Handle(1, type.handle_type),
+                                            "tiramisu_address_of_" +
+                                            str_from_tiramisu_type_primitive(buf->get_elements_type()),
+                                            {base, Halide::Expr(0)},
+                                            Halide::Internal::Call::Extern);
+        Halide::Internal::Stmt create = Halide::Internal::Evaluate::make(
+                make_comm_call(Halide::Bool(), "tiramisu_MPI_Win_create",
+                               {Halide::Expr(id), base, Halide::cast(Halide::Int(64), size), Halide::Expr(type.bytes())}));
+        stmt = Halide::Internal::Block::make(create, stmt);
+    }
+
     Halide::Internal::Stmt freestmts;
     for (const auto &b : this->get_buffers())
     {
@@ -2504,6 +2650,13 @@ void function::gen_halide_stmt()
         stmt = Halide::Internal::LetStmt::make("rank", mpi_rank, stmt);
     }
 
+    if (this->communicates_in_parallel_loops()) {
+        // The threads of the parallel loops call MPI concurrently: check that MPI supports it.
+        stmt = Halide::Internal::Block::make(
+                Halide::Internal::Evaluate::make(make_comm_call(Halide::Bool(), "tiramisu_MPI_check_thread_multiple", {})),
+                stmt);
+    }
+
     // Add producer tag
     stmt = Halide::Internal::ProducerConsumer::make_produce("", stmt);
 
@@ -2519,7 +2672,30 @@ Halide::Internal::Stmt generator::make_buffer_alloc(buffer *b, const std::vector
                                                     Halide::Internal::Stmt &stmt) {
     using cuda_ast::memory_location;
     auto h_type = halide_type_from_tiramisu_type(b->get_elements_type());
-    if (b->location == memory_location::host)
+    if ((b->location == memory_location::host) && !b->get_storage_file().empty())
+    {
+        // Map the buffer from its file for the duration of the function.  The
+        // function returns -1 (halide_error_code_generic_error) if it cannot be mapped.
+        Halide::Expr size = Halide::cast(Halide::Int(64), extents[0]);
+        for (int i = 1; i < extents.size(); i++)
+        {
+            size = size * Halide::cast(Halide::Int(64), extents[i]);
+        }
+        size = size * h_type.bytes();
+        Halide::Expr ptr = Halide::Internal::Variable::make(Halide::Handle(), b->get_name());
+        Halide::Internal::Stmt unmap = Halide::Internal::Evaluate::make(
+                Halide::Internal::Call::make(Halide::Int(32), "tiramisu_munmap_buffer", {ptr, size},
+                                             Halide::Internal::Call::Extern));
+        Halide::Internal::Stmt check = Halide::Internal::AssertStmt::make(
+                Halide::reinterpret(Halide::UInt(64), ptr) != Halide::Expr((uint64_t) 0), Halide::Expr(-1));
+        return Halide::Internal::LetStmt::make(
+                b->get_name(),
+                Halide::Internal::Call::make(Halide::Handle(), "tiramisu_mmap_buffer",
+                                             {Halide::Expr(b->get_storage_file()), size},
+                                             Halide::Internal::Call::Extern),
+                Halide::Internal::Block::make(check, Halide::Internal::Block::make(stmt, unmap)));
+    }
+    else if (b->location == memory_location::host)
     {
         return Halide::Internal::Allocate::make(
                 b->get_name(),
@@ -3145,7 +3321,8 @@ void computation::create_halide_assignment()
             // Defines writing into the wait buffer when a transfer is initiated (for nonblocking operations)
             if (this->wait_argument_idx != -1) {
                 ERROR("Nonblocking not currently supported", 0);
-                assert((this->is_recv() || this->is_send_recv()) && "This should be a recv or one-sided operation.");
+                assert((this->is_recv() || this->is_send_recv() || this->is_collective()) &&
+                       "This should be a recv, one-sided or collective operation.");
                 assert(this->wait_access_map && "A wait access map must be provided.");
                 // We treat this like another LHS access, so we'll recompute the LHS access using the req access map.
                 // First, find the request buffer.
@@ -3210,7 +3387,8 @@ void computation::create_halide_assignment()
             std::vector<Halide::Expr> halide_call_args;
             halide_call_args.resize(this->library_call_args.size());
             for (int i = 0; i < this->library_call_args.size(); i++) {
-                if (i != this->rhs_argument_idx && i != this->lhs_argument_idx && i != this->wait_argument_idx) {
+                if (i != this->rhs_argument_idx && i != this->lhs_argument_idx && i != this->wait_argument_idx &&
+                    i != this->rma_argument_idx) {
                     std::vector<isl_ast_expr *> dummy;
                     halide_call_args[i] = generator::halide_expr_from_tiramisu_expr(this->get_function(), dummy,
                                                                                     this->library_call_args[i], this);
@@ -3224,7 +3402,7 @@ void computation::create_halide_assignment()
             }
             if (this->wait_argument_idx != -1) {
                 ERROR("Nonblocking not currently supported", 0);
-                assert(this->is_send() && "This should be a send operation.");
+                assert((this->is_send() || this->is_collective()) && "This should be a send or collective operation.");
                 assert(this->wait_access_map && "A request access map must be provided.");
                 // We treat this like another LHS access, so we'll recompute the LHS access using the req access map.
                 // First, find the request buffer.
@@ -3262,9 +3440,49 @@ void computation::create_halide_assignment()
                 // which is either a send or a receive
                 halide_call_args[wait_argument_idx] = result;
             }
-            // Create the library call (assumed to be a communication call for right now)
-            this->stmt = Halide::Internal::Evaluate::make(make_comm_call(Halide::Bool(), this->library_call_name,
-                                                                         halide_call_args));
+            // The displacement (in elements) of the data of a one-sided send in the window of the receiver
+            if (this->rma_argument_idx != -1) {
+                assert(this->is_send() && "Only sends can be one-sided.");
+                assert(this->rma_access_map && "A one-sided send needs the access of its receive.");
+                const auto &target_buffer_entry = this->fct->get_buffers().find(
+                        isl_map_get_tuple_name(this->rma_access_map, isl_dim_out));
+                assert(target_buffer_entry != this->fct->get_buffers().end());
+                const auto &target_tiramisu_buffer = target_buffer_entry->second;
+                std::vector<isl_ast_expr *> empty_index_expr;
+                std::vector<Halide::Expr> target_strides_vector;
+                Halide::Expr stride_expr = Halide::Expr(1);
+                for (int i = 0; i < target_tiramisu_buffer->get_dim_sizes().size(); i++) {
+                    int dim_idx = target_tiramisu_buffer->get_dim_sizes().size() - i - 1;
+                    target_strides_vector.push_back(stride_expr);
+                    stride_expr = stride_expr * generator::halide_expr_from_tiramisu_expr(fct, empty_index_expr,
+                                                                                          target_tiramisu_buffer->get_dim_sizes()[dim_idx], this);
+                }
+                assert(this->rma_index_expr != NULL);
+                Halide::Expr target_index = tiramisu::generator::linearize_access(
+                        target_tiramisu_buffer->get_dim_sizes().size(), target_strides_vector, this->rma_index_expr);
+                halide_call_args[rma_argument_idx] = Halide::cast(Halide::Int(64), target_index);
+            }
+            if (this->library_call_name == "tiramisu_prefetch") {
+                // Software prefetches (computation::prefetch()) are lowered to the prefetch
+                // intrinsic of Halide, which LLVM inlines, instead of a call to an extern.
+                // The RHS is the linear index of the prefetched element in the buffer of the input.
+                assert(this->rhs_argument_idx != -1);
+                std::vector<tiramisu::computation *> input =
+                        this->get_function()->get_computation_by_name(this->get_expr().get_name());
+                assert(!input.empty());
+                std::string input_buffer_name = isl_map_get_tuple_name(input[0]->get_access_relation(),
+                                                                       isl_dim_out);
+                Halide::Expr base = Halide::Internal::Variable::make(Halide::Handle(), input_buffer_name);
+                this->stmt = Halide::Internal::Evaluate::make(
+                        Halide::Internal::Call::make(halide_type_from_tiramisu_type(this->get_expr().get_data_type()),
+                                                     Halide::Internal::Call::prefetch,
+                                                     {base, halide_call_args[rhs_argument_idx], 1, 1},
+                                                     Halide::Internal::Call::Intrinsic));
+            } else {
+                // Create the library call (assumed to be a communication call for right now)
+                this->stmt = Halide::Internal::Evaluate::make(make_comm_call(Halide::Bool(), this->library_call_name,
+                                                                             halide_call_args));
+            }
 
         }
     }
@@ -3949,6 +4167,54 @@ void function::gen_halide_obj(const std::string &obj_file_name, Halide::Target::
                                              Halide::Internal::LoweredFunc::External,
                                              this->get_halide_stmt());
 
+    if (this->batched_entry_point)
+    {
+        // Call the function on each element of the batch in parallel.
+        // The arguments are arrays of pointers to the buffers of the batch.
+        std::vector<Halide::Argument> batched_arguments;
+        std::vector<Halide::Expr> call_args;
+        Halide::Expr batch_idx = Halide::Internal::Variable::make(Halide::Int(32), "batch_idx");
+
+        batched_arguments.push_back(Halide::Argument("batch_size", Halide::Argument::InputScalar,
+                                                     Halide::Int(32), 0));
+        for (const auto &buf : this->function_arguments)
+        {
+            std::string array_name = buf->get_name() + "_batch";
+            batched_arguments.push_back(Halide::Argument(array_name, Halide::Argument::InputScalar,
+                                                         Halide::Handle(), 0));
+            Halide::Expr array = Halide::Internal::Variable::make(Halide::Handle(), array_name);
+            call_args.push_back(Halide::Internal::Call::make(Halide::type_of<struct halide_buffer_t *>(),
+                                                             "tiramisu_batch_get_buffer", {array, batch_idx},
+                                                             Halide::Internal::Call::Extern));
+        }
+
+        // Each element stores its return code, and the batched function returns
+        // the first nonzero one (a failed assertion returns its message).
+        std::string codes_name = this->get_name() + "_batch_codes";
+        Halide::Expr batch_size = Halide::Internal::Variable::make(Halide::Int(32), "batch_size");
+        Halide::Internal::Stmt body = Halide::Internal::Store::make(
+                codes_name,
+                Halide::Internal::Call::make(Halide::Int(32), this->get_name(), call_args,
+                                             Halide::Internal::Call::Extern),
+                batch_idx, Halide::Internal::Parameter(), Halide::Internal::const_true());
+        body = Halide::Internal::For::make("batch_idx", Halide::Expr(0), batch_size,
+                                           Halide::Internal::ForType::Parallel,
+                                           Halide::DeviceAPI::Host, body);
+        Halide::Expr code = Halide::Internal::Load::make(Halide::Int(32), codes_name, batch_idx, Halide::Buffer<>(),
+                                                         Halide::Internal::Parameter(),
+                                                         Halide::Internal::const_true());
+        Halide::Internal::Stmt check = Halide::Internal::AssertStmt::make(code == 0, code);
+        check = Halide::Internal::For::make("batch_idx", Halide::Expr(0), batch_size,
+                                            Halide::Internal::ForType::Serial,
+                                            Halide::DeviceAPI::Host, check);
+        body = Halide::Internal::Allocate::make(codes_name, Halide::Int(32), {batch_size},
+                                                Halide::Internal::const_true(),
+                                                Halide::Internal::Block::make(body, check));
+
+        m.append(Halide::Internal::LoweredFunc(this->get_name() + "_batched", batched_arguments, body,
+                                               Halide::Internal::LoweredFunc::External));
+    }
+
     m.compile(Halide::Outputs().object(obj_file_name));
     m.compile(Halide::Outputs().c_header(obj_file_name + ".h"));
 
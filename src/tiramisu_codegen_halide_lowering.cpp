@@ -38,7 +38,7 @@ Module lower_halide_pipeline(const string &pipeline_name,
     // the sliding window and storage folding passes.
     map<string, Function> env;
 
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         std::cout << "Lower halide pipeline...\n" << s << "\n";
         std::flush(std::cout);
@@ -180,7 +180,7 @@ Module lower_halide_pipeline(const string &pipeline_name,
     s = remove_trivial_for_loops(s);
     s = simplify(s);
     // s = loop_invariant_code_motion(s);
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         std::cout << "Lowering after final simplification:\n" << s << "\n";
         std::flush(std::cout);
@@ -3,6 +3,8 @@
 #include <isl/set.h>
 #include <isl/map.h>
 #include <isl/id.h>
+#include <isl/ilp.h>
+#include <isl/val.h>
 #include <isl/constraint.h>
 #include <isl/union_map.h>
 #include <isl/union_set.h>
@@ -26,6 +28,7 @@ static int next_dim_name = 0;
 bool global::auto_data_mapping = false;
 primitive_t global::loop_iterator_type = p_int32;
 function *global::implicit_fct;
+bool global::schedule_tree_codegen = false;
 std::unordered_map<std::string, var> var::declared_vars;
 const var computation::root = var("root");
 
@@ -91,6 +94,14 @@ void codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string
     fct->codegen(arguments, obj_filename, gen_cuda_stmt);
 }
 
+void codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string obj_filename,
+             const std::vector<std::map<std::string, int>> &specializations,
+             const bool gen_cuda_stmt)
+{
+    function *fct = global::get_implicit_function();
+    fct->codegen(arguments, obj_filename, specializations, gen_cuda_stmt);
+}
+
 //********************************************************
 
 isl_set *tiramisu::computation::get_iteration_domains_of_all_definitions()
@@ -281,7 +292,7 @@ void tiramisu::computation::rename_computation(std::string new_name)
     DEBUG(10, tiramisu::str_dump("Setting the schedule relation to ", isl_map_to_str(sched)));
     this->set_schedule(sched);
 
-    // Rename parallel, unroll, vectorize and gpu vectors
+    // Rename parallel, unroll, vectorize, gpu, AST loop type and stream vectors
     for (auto &pd : this->get_function()->unroll_dimensions)
         if (std::get<0>(pd) == old_name)
             std::get<0>(pd) = new_name;
@@ -297,6 +308,12 @@ void tiramisu::computation::rename_computation(std::string new_name)
     for (auto &pd : this->get_function()->vector_dimensions)
         if (std::get<0>(pd) == old_name)
             std::get<0>(pd) = new_name;
+    for (auto &pd : this->get_function()->ast_loop_types)
+        if (std::get<0>(pd) == old_name)
+            std::get<0>(pd) = new_name;
+    for (auto &pd : this->get_function()->stream_dimensions)
+        if (std::get<0>(pd) == old_name)
+            std::get<0>(pd) = new_name;
 
     DEBUG_INDENT(-4);
 }
@@ -583,6 +600,30 @@ void tiramisu::computation::tag_distribute_level(int L)
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::distribute_block_cyclic(tiramisu::var L, int block_size, int number_of_ranks,
+                                                    tiramisu::var L_cycle, tiramisu::var L_rank,
+                                                    tiramisu::var L_block)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L.get_name().length() > 0);
+    assert(block_size > 0);
+    assert(number_of_ranks > 0);
+
+    std::string L_ranks_name = generate_new_variable_name();
+    tiramisu::var L_ranks(L_ranks_name);
+
+    // L -> (L_cycle, L_ranks) -> (L_cycle, L_rank, L_block)
+    this->split(L, block_size * number_of_ranks, L_cycle, L_ranks);
+    this->split(L_ranks, block_size, L_rank, L_block);
+    this->tag_distribute_level(L_rank);
+
+    DEBUG(3, tiramisu::str_dump("Schedule after block-cyclic distribution: ", isl_map_to_str(this->get_schedule())));
+
+    DEBUG_INDENT(-4);
+}
+
 void tiramisu::computation::tag_parallel_level(tiramisu::var L0_var)
 {
     DEBUG_FCT_NAME(3);
@@ -640,6 +681,131 @@ void tiramisu::computation::tag_unroll_level(int level, int factor)
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::set_ast_loop_type(tiramisu::var L0_var, tiramisu::ast_loop_t type)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0_var.get_name().length() > 0);
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+    int L0 = dimensions[0];
+
+    this->set_ast_loop_type(L0, type);
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::set_ast_loop_type(int level, tiramisu::ast_loop_t type)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(level >= 0);
+    assert(!this->get_name().empty());
+    assert(this->get_function() != NULL);
+
+    this->get_function()->add_ast_loop_type(this->get_name(), level, type);
+
+    DEBUG_INDENT(-4);
+}
+
+/**
+  * Return the dimension of the domain of \p access that indexes the outermost
+  * dimension of the buffer, or -1 if there is none.
+  */
+static int get_outermost_buffer_dimension_index(isl_map *access)
+{
+    for (int k = 0; k < isl_map_dim(access, isl_dim_in); k++)
+    {
+        isl_map *equal = isl_map_universe(isl_map_get_space(access));
+        equal = isl_map_equate(equal, isl_dim_in, k, isl_dim_out, 0);
+        bool indexes = (isl_map_is_subset(access, equal) == isl_bool_true);
+        isl_map_free(equal);
+        if (indexes)
+            return k;
+    }
+    return -1;
+}
+
+/**
+  * Return true if \p buf is in \p buffers.
+  */
+static bool is_streamed_buffer(const std::vector<tiramisu::buffer *> &buffers, const std::string &buf)
+{
+    for (auto b : buffers)
+        if (b->get_name() == buf)
+            return true;
+    return false;
+}
+
+/**
+  * Report an error if an access of \p e to a computation stored in one of
+  * \p buffers does not index the outermost dimension of the buffer with
+  * the iterator \p L.
+  */
+static void check_streamed_accesses(const tiramisu::function *fct, const tiramisu::expr &e,
+                                    const std::vector<tiramisu::buffer *> &buffers, const std::string &L)
+{
+    if ((e.get_expr_type() == tiramisu::e_op) && (e.get_op_type() == tiramisu::o_access))
+    {
+        std::vector<tiramisu::computation *> producers = fct->get_computation_by_name(e.get_name());
+        if (!producers.empty() && (producers[0]->get_access_relation() != NULL))
+        {
+            isl_map *access = producers[0]->get_access_relation();
+            if (is_streamed_buffer(buffers, isl_map_get_tuple_name(access, isl_dim_out)))
+            {
+                int k = get_outermost_buffer_dimension_index(access);
+                if ((k < 0) || (k >= e.get_access().size()) ||
+                    (e.get_access()[k].get_expr_type() != tiramisu::e_var) ||
+                    (e.get_access()[k].get_name() != L))
+                    ERROR("The access " + e.to_str() + " should use the streamed loop " + L +
+                          " to index the outermost dimension of the buffer " +
+                          isl_map_get_tuple_name(access, isl_dim_out) + ".", true);
+            }
+        }
+    }
+
+    e.apply_to_operands([&](const tiramisu::expr &operand)
+    {
+        check_streamed_accesses(fct, operand, buffers, L);
+        return operand;
+    });
+}
+
+void tiramisu::computation::stream(tiramisu::var L, int rows, const std::vector<tiramisu::buffer *> &buffers,
+                                   tiramisu::var L_outer, tiramisu::var L_inner)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L.get_name().length() > 0);
+    assert(rows > 0);
+    assert(!buffers.empty());
+
+    // The tile t of L_outer uses the rows t * rows ... (t + 1) * rows - 1 of
+    // the buffers only if L indexes their outermost dimension.
+    if (this->get_access_relation() == NULL)
+        ERROR("The computation " + this->get_name() + " should be stored (store_in()) before it is streamed.", true);
+    if (is_streamed_buffer(buffers, isl_map_get_tuple_name(this->get_access_relation(), isl_dim_out)) &&
+        (get_outermost_buffer_dimension_index(this->get_access_relation()) !=
+         isl_set_find_dim_by_name(this->get_iteration_domain(), isl_dim_set, L.get_name().c_str())))
+        ERROR("The streamed loop " + L.get_name() + " should index the outermost dimension of the buffer of " +
+              this->get_name() + ".", true);
+    check_streamed_accesses(this->get_function(), this->get_expr(), buffers, L.get_name());
+
+    this->split(L, rows, L_outer, L_inner);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L_outer.get_name()});
+    this->check_dimensions_validity(dimensions);
+
+    this->get_function()->add_stream_dimension(this->get_name(), dimensions[0], buffers, rows);
+
+    DEBUG_INDENT(-4);
+}
+
 tiramisu::computation *tiramisu::computation::copy()
 {
     DEBUG_FCT_NAME(3);
@@ -961,6 +1127,7 @@ void tiramisu::computation::separate_at(var _level, std::vector<tiramisu::expr>
 void tiramisu::computation::set_iteration_domain(isl_set *domain)
 {
     this->iteration_domain = domain;
+    this->schedule_version++;
 }
 
 std::string utility::get_parameters_list(isl_set *set)
@@ -1294,7 +1461,7 @@ void tiramisu::computation::unroll(tiramisu::var L0_var, int v, tiramisu::var L0
 
 void computation::dump_iteration_domain() const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         isl_set_dump(this->get_iteration_domain());
     }
@@ -1304,7 +1471,7 @@ void computation::dump_schedule() const
 {
     DEBUG_INDENT(4);
 
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         tiramisu::str_dump("Dumping the schedule of the computation " + this->get_name() + " : ");
 
@@ -1317,7 +1484,7 @@ void computation::dump_schedule() const
 
 void computation::dump() const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         std::cout << std::endl << "Dumping the computation \"" + this->get_name() + "\" :" << std::endl;
         std::cout << "Iteration domain of the computation \"" << this->name << "\" : ";
@@ -1480,6 +1647,23 @@ void buffer::set_auto_allocate(bool auto_allocation)
     this->auto_allocate = auto_allocation;
 }
 
+void buffer::set_storage_file(const std::string &file_name)
+{
+    assert(!file_name.empty() && "Empty storage file name");
+
+    if (this->get_argument_type() != tiramisu::a_temporary)
+    {
+        ERROR("Only temporary buffers can be mapped from a file (buffer " + this->get_name() + ").", true);
+    }
+
+    this->storage_file = file_name;
+}
+
+const std::string &buffer::get_storage_file() const
+{
+    return this->storage_file;
+}
+
 bool buffer::get_auto_allocate()
 {
     return this->auto_allocate;
@@ -1603,6 +1787,7 @@ void computation::add_schedule_constraint(std::string domain_constraints,
 void tiramisu::computation::set_schedule(isl_map *map)
 {
     this->schedule = map;
+    this->schedule_version++;
 }
 
 
@@ -2462,10 +2647,10 @@ void computation::set_loop_level_names(std::vector<std::string> names)
     {
         if (isl_map_has_dim_name(this->get_schedule(), isl_dim_out, loop_level_into_dynamic_dimension(i)) == isl_bool_true)
         {
-            this->schedule = isl_map_set_dim_name(this->get_schedule(),
-                                                  isl_dim_out,
-                                                  loop_level_into_dynamic_dimension(i),
-                                                  names[i].c_str());
+            this->set_schedule(isl_map_set_dim_name(this->get_schedule(),
+                                                    isl_dim_out,
+                                                    loop_level_into_dynamic_dimension(i),
+                                                    names[i].c_str()));
             DEBUG(3, tiramisu::str_dump("Setting the name of loop level " + std::to_string(i) + " into " + names[i].c_str()));
         }
     }
@@ -2488,8 +2673,8 @@ void computation::set_schedule_domain_dim_names(std::vector<int> loop_levels,
     for (int i = 0; i < loop_levels.size(); i++)
     {
         assert(loop_levels[i] <= isl_map_dim(this->get_schedule(), isl_dim_in));
-        this->schedule = isl_map_set_dim_name(this->get_schedule(),
-                                              isl_dim_in, loop_levels[i], names[i].c_str());
+        this->set_schedule(isl_map_set_dim_name(this->get_schedule(),
+                                                isl_dim_in, loop_levels[i], names[i].c_str()));
         DEBUG(3, tiramisu::str_dump("Setting the name of the domain of the schedule dimension " + std::to_string(loop_levels[i]) + " into " + names[i].c_str()));
     }
 
@@ -2512,10 +2697,10 @@ void computation::set_loop_level_names(std::vector<int> loop_levels,
     {
         if (loop_level_into_static_dimension(loop_levels[i]) <= isl_map_dim(this->get_schedule(), isl_dim_out))
         {
-            this->schedule = isl_map_set_dim_name(this->get_schedule(),
-                                                  isl_dim_out,
-                                                  loop_level_into_dynamic_dimension(loop_levels[i]),
-                                                  names[i].c_str());
+            this->set_schedule(isl_map_set_dim_name(this->get_schedule(),
+                                                    isl_dim_out,
+                                                    loop_level_into_dynamic_dimension(loop_levels[i]),
+                                                    names[i].c_str()));
             DEBUG(3, tiramisu::str_dump("Setting the name of loop level " + std::to_string(loop_levels[i]) + " into " + names[i].c_str()));
         }
     }
@@ -3968,94 +4153,659 @@ void computation::skew(int L0, int L1, int L2, int L3, int factor)
     DEBUG_INDENT(-4);
 }
 
-void computation::shift(tiramisu::var L0_var, int n)
+/**
+ * Compute the minimal and the maximal values of the dimension \p dim
+ * of \p set. Return false if one of the two values is not a constant
+ * (e.g., if the set is empty or unbounded).
+ */
+static bool get_dimension_bounds(isl_set *set, int dim, int &min_value, int &max_value)
+{
+    assert(set != NULL);
+    assert(dim >= 0 && dim < isl_set_dim(set, isl_dim_set));
+
+    isl_aff *dim_aff = isl_aff_var_on_domain(isl_local_space_from_space(isl_set_get_space(set)),
+                                             isl_dim_set, dim);
+    isl_val *min = isl_set_min_val(set, dim_aff);
+    isl_val *max = isl_set_max_val(set, dim_aff);
+    isl_aff_free(dim_aff);
+
+    bool bounded = (isl_val_is_int(min) == isl_bool_true) && (isl_val_is_int(max) == isl_bool_true);
+    if (bounded)
+    {
+        min_value = isl_val_get_num_si(min);
+        max_value = isl_val_get_num_si(max);
+    }
+
+    isl_val_free(min);
+    isl_val_free(max);
+
+    return bounded;
+}
+
+isl_set *computation::compute_self_dependence_distances(int L0, int L1)
+{
+    isl_set *distances = this->get_function()->compute_fusion_distances(this, this, L1);
+
+    if (distances != NULL)
+    {
+        for (int l = 0; l < L0; l++)
+        {
+            distances = isl_set_fix_si(distances, isl_dim_set, l, 0);
+        }
+    }
+
+    return distances;
+}
+
+void computation::diamond_tile(tiramisu::var L0_var, tiramisu::var L1_var, int size)
 {
     DEBUG_FCT_NAME(3);
     DEBUG_INDENT(4);
 
     assert(L0_var.get_name().length() > 0);
+    assert(L1_var.get_name().length() > 0);
+
     std::vector<int> dimensions =
-        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name(), L1_var.get_name()});
     this->check_dimensions_validity(dimensions);
-    int L0 = dimensions[0];
 
-    this->shift(L0, n);
+    this->diamond_tile(dimensions[0], dimensions[1], size);
 
     DEBUG_INDENT(-4);
 }
 
-void computation::shift(int L0, int n)
+void computation::diamond_tile(int L0, int L1, int size)
 {
     DEBUG_FCT_NAME(3);
     DEBUG_INDENT(4);
 
-    int dim0 = loop_level_into_dynamic_dimension(L0);
+    if (L0 + 1 != L1)
+    {
+        ERROR("Loop levels passed to diamond_tile() should be consecutive. The first argument to diamond_tile() should be the time loop level.", true);
+    }
+    assert(size > 0);
+    this->check_dimensions_validity({L0, L1});
 
-    assert(this->get_schedule() != NULL);
-    assert(dim0 >= 0);
-    assert(dim0 < isl_space_dim(isl_map_get_space(this->get_schedule()), isl_dim_out));
+    // Compute the slope of the tiles from the dependence distances:
+    // for each dependence distance (dt, ds), we need f*dt >= |ds|.
+    int factor = 1;
+    isl_set *distances = this->compute_self_dependence_distances(L0, L1);
+    if ((distances != NULL) && (isl_set_is_empty(distances) == isl_bool_false))
+    {
+        int dt_min, dt_max, ds_min, ds_max;
 
+        if (!get_dimension_bounds(distances, L0, dt_min, dt_max) ||
+            !get_dimension_bounds(distances, L1, ds_min, ds_max))
+        {
+            ERROR("diamond_tile() requires the dependence distances of " + this->get_name() +
+                  " to be constant.", true);
+        }
 
-    DEBUG(3, tiramisu::str_dump("Creating a schedule that shifts the loop level ");
-          tiramisu::str_dump(std::to_string(L0));
-          tiramisu::str_dump(" of the computation ");
-          tiramisu::str_dump(this->get_name());
-          tiramisu::str_dump(" by ");
-          tiramisu::str_dump(std::to_string(n)));
+        if (dt_min < 1)
+        {
+            ERROR("diamond_tile() requires all the dependences of " + this->get_name() +
+                  " to be carried by the time loop level.", true);
+        }
+
+        int ds = std::max(-ds_min, ds_max);
+        factor = std::max(1, (ds + dt_min - 1) / dt_min);
+    }
+    isl_set_free(distances);
+
+    int dim0 = loop_level_into_dynamic_dimension(L0);
+    int dim1 = loop_level_into_dynamic_dimension(L1);
+
+    DEBUG(3, tiramisu::str_dump("Diamond tiling the loop levels " + std::to_string(L0) + " and " +
+                                std::to_string(L1) + " of the computation " + this->get_name() +
+                                " with a tile size of " + std::to_string(size) +
+                                " and a slope of " + std::to_string(factor)));
 
     this->get_function()->align_schedules();
     assert(this->get_schedule() != NULL);
 
-    DEBUG(3, tiramisu::str_dump("Original schedule: ",
-                                isl_map_to_str(this->get_schedule())));
+    isl_map *schedule = this->get_schedule();
+    int duplicate_ID = isl_map_get_static_dim(schedule, 0);
 
-    isl_map *new_sched = isl_map_copy(this->get_schedule());
-    new_sched = add_eq_to_schedule_map(dim0, -1, -1, n, new_sched);
-    this->set_schedule(new_sched);
-    DEBUG(3, tiramisu::str_dump("Schedule after shifting: ",
+    schedule = isl_map_copy(schedule);
+    schedule = isl_map_set_tuple_id(schedule, isl_dim_out,
+                                    isl_id_alloc(this->get_ctx(), this->get_name().c_str(), NULL));
+
+    DEBUG(3, tiramisu::str_dump("Original schedule: ", isl_map_to_str(schedule)));
+
+    // The time loop L0 is replaced by the loops (W, T, L0): W is the wavefront
+    // of diamond tiles and T enumerates the (independent) tiles of a wavefront.
+    std::string wavefront_str = generate_new_variable_name();
+    std::string static0_str = generate_new_variable_name();
+    std::string tile_str = generate_new_variable_name();
+    std::string static1_str = generate_new_variable_name();
+
+    int n_dims = isl_map_dim(this->get_schedule(), isl_dim_out);
+    std::vector<std::string> dimensions_str;
+    std::vector<std::string> out_dimensions_str;
+
+    for (int i = 0; i < n_dims; i++)
+    {
+        dimensions_str.push_back(generate_new_variable_name());
+
+        if (i == dim0)
+        {
+            out_dimensions_str.push_back(wavefront_str);
+            out_dimensions_str.push_back(static0_str);
+            out_dimensions_str.push_back(tile_str);
+            out_dimensions_str.push_back(static1_str);
+        }
+        out_dimensions_str.push_back(dimensions_str[i]);
+    }
+
+    std::string map = "{" + this->get_name() + "[";
+    for (int i = 0; i < dimensions_str.size(); i++)
+    {
+        map = map + dimensions_str[i] + ((i != dimensions_str.size() - 1) ? "," : "");
+    }
+    map = map + "] -> " + this->get_name() + "[";
+    for (int i = 0; i < out_dimensions_str.size(); i++)
+    {
+        map = map + out_dimensions_str[i] + ((i != out_dimensions_str.size() - 1) ? "," : "");
+    }
+
+    // The tiles are delimited by the hyperplanes (f*t + s) and (f*t - s).
+    std::string t = std::to_string(factor) + "*" + dimensions_str[dim0];
+    std::string s = dimensions_str[dim1];
+    std::string tile0 = "floor((" + t + " + " + s + ")/" + std::to_string(size) + ")";
+    std::string tile1 = "floor((" + t + " - " + s + ")/" + std::to_string(size) + ")";
+
+    map = map + "] : " + dimensions_str[0] + " = " + std::to_string(duplicate_ID) + " and " +
+          static0_str + " = 0 and " + static1_str + " = 0 and " +
+          tile_str + " = " + tile0 + " and " + wavefront_str + " = " + tile0 + " + " + tile1 + "}";
+
+    DEBUG(3, tiramisu::str_dump("Transformation map (string format) : " + map));
+
+    isl_map *transformation_map = isl_map_read_from_str(this->get_ctx(), map.c_str());
+
+    for (int i = 0; i < out_dimensions_str.size(); i++)
+        transformation_map = isl_map_set_dim_id(
+                                 transformation_map, isl_dim_out, i,
+                                 isl_id_alloc(this->get_ctx(), out_dimensions_str[i].c_str(), NULL));
+
+    transformation_map = isl_map_set_tuple_id(
+                             transformation_map, isl_dim_in,
+                             isl_map_get_tuple_id(isl_map_copy(schedule), isl_dim_out));
+    isl_id *id_range = isl_id_alloc(this->get_ctx(), this->get_name().c_str(), NULL);
+    transformation_map = isl_map_set_tuple_id(transformation_map, isl_dim_out, id_range);
+
+    DEBUG(3, tiramisu::str_dump("Transformation map : ",
+                                isl_map_to_str(transformation_map)));
+
+    schedule = isl_map_apply_range(isl_map_copy(schedule), isl_map_copy(transformation_map));
+
+    this->set_schedule(schedule);
+    DEBUG(3, tiramisu::str_dump("Schedule after diamond tiling: ",
                                 isl_map_to_str(this->get_schedule())));
 
+    // The tiles of the same wavefront are independent.
+    this->tag_parallel_level(L0 + 1);
+
     DEBUG_INDENT(-4);
 }
 
-isl_set *computation::simplify(isl_set *set)
+void computation::wavefront(tiramisu::var L0_var, tiramisu::var L1_var)
 {
-    set = this->intersect_set_with_context(set);
-    set = isl_set_coalesce(set);
-    set = isl_set_remove_redundancies(set);
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
 
-    return set;
+    this->wavefront(L0_var, L1_var, 0, 0);
+
+    DEBUG_INDENT(-4);
 }
 
-isl_map *computation::simplify(isl_map *map)
+void computation::wavefront(tiramisu::var L0_var, tiramisu::var L1_var, int sizeX, int sizeY)
 {
-    map = this->intersect_map_domain_with_context(map);
-    map = isl_map_coalesce(map);
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
 
-    return map;
+    assert(L0_var.get_name().length() > 0);
+    assert(L1_var.get_name().length() > 0);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name(), L1_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+
+    this->wavefront(dimensions[0], dimensions[1], sizeX, sizeY);
+
+    DEBUG_INDENT(-4);
 }
 
-isl_set *computation::intersect_set_with_context(isl_set *set)
+void computation::wavefront(int L0, int L1)
 {
     DEBUG_FCT_NAME(3);
     DEBUG_INDENT(4);
 
-    // Unify the space of the context and the "missing" set so that we can intersect them.
-    isl_set *context = isl_set_copy(this->get_function()->get_program_context());
-    if (context != NULL)
+    this->wavefront(L0, L1, 0, 0);
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::wavefront(int L0, int L1, int sizeX, int sizeY)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (L0 + 1 != L1)
     {
-        isl_space *model = isl_set_get_space(isl_set_copy(context));
-        set = isl_set_align_params(set, isl_space_copy(model));
-        DEBUG(10, tiramisu::str_dump("Context: ", isl_set_to_str(context)));
-        DEBUG(10, tiramisu::str_dump("Set after aligning its parameters with the context parameters: ",
-                                     isl_set_to_str (set)));
+        ERROR("Loop levels passed to wavefront() should be consecutive. The first argument to wavefront() should be the outer loop level.", true);
+    }
+    assert((sizeX >= 0) && (sizeY >= 0));
+    this->check_dimensions_validity({L0, L1});
 
-        isl_id *missing_id1 = NULL;
-        if (isl_set_has_tuple_id(set) == isl_bool_true)
+    bool tiled = (sizeX > 0) && (sizeY > 0);
+
+    // Compute the skewing factor f from the dependence distances (d0, d1).
+    // Without tiling, every dependence should be carried by the wavefront
+    // (f*L0 + L1), i.e., f*d0 + d1 >= 1.  With tiling, the skewed distances
+    // should only be non-negative so that tiling is legal, i.e., f*d0 + d1 >= 0.
+    int min_distance = tiled ? 0 : 1;
+    int factor = 0;
+    isl_set *distances = this->compute_self_dependence_distances(L0, L1);
+    if ((distances != NULL) && (isl_set_is_empty(distances) == isl_bool_false))
+    {
+        int d0_min, d0_max, d1_min, d1_max;
+
+        // Dependences carried by L1 only.
+        isl_set *inner = isl_set_fix_si(isl_set_copy(distances), isl_dim_set, L0, 0);
+        if (isl_set_is_empty(inner) == isl_bool_false)
         {
-            missing_id1 = isl_set_get_tuple_id(set);
+            if (!get_dimension_bounds(inner, L1, d1_min, d1_max) || d1_min < 1)
+            {
+                ERROR("wavefront() requires constant and positive dependence distances at the inner loop level.", true);
+            }
         }
-        else
+        isl_set_free(inner);
+
+        // Dependences carried by L0.
+        isl_set *outer = isl_set_lower_bound_si(isl_set_copy(distances), isl_dim_set, L0, 1);
+        if (isl_set_is_empty(outer) == isl_bool_false)
+        {
+            if (!get_dimension_bounds(outer, L0, d0_min, d0_max) ||
+                !get_dimension_bounds(outer, L1, d1_min, d1_max))
+            {
+                ERROR("wavefront() requires the dependence distances of " + this->get_name() +
+                      " to be constant.", true);
+            }
+
+            if (d1_min < min_distance)
+            {
+                factor = (min_distance - d1_min + d0_min - 1) / d0_min;
+            }
+        }
+        isl_set_free(outer);
+    }
+    isl_set_free(distances);
+
+    DEBUG(3, tiramisu::str_dump("Wavefront on the loop levels " + std::to_string(L0) + " and " +
+                                std::to_string(L1) + " of the computation " + this->get_name() +
+                                " with a skewing factor of " + std::to_string(factor)));
+
+    if (factor > 0)
+    {
+        this->skew(L0, L1, factor);
+    }
+
+    if (tiled)
+    {
+        // All the distances are non-negative, so tiles only depend on the
+        // previous tile in each dimension: a wavefront of tiles with a
+        // factor 1 carries all the dependences between tiles.
+        this->tile(L0, L1, sizeX, sizeY);
+        this->skew(L0, L1, 1);
+    }
+
+    // The wavefront (the skewed loop L1, or the loop L1 itself if it already
+    // carries all the dependences) becomes the outer loop and the inner loop
+    // is parallel.
+    this->interchange(L0, L1);
+    this->tag_parallel_level(L1);
+
+    DEBUG_INDENT(-4);
+}
+
+/**
+  * Collect in \p accesses the accesses to the computation \p name in \p e
+  * (including the accesses nested in the indices of other accesses).
+  */
+static void collect_accesses_to_computation(const tiramisu::expr &e, const std::string &name,
+                                            std::vector<tiramisu::expr> &accesses)
+{
+    if ((e.get_expr_type() == tiramisu::e_op) && (e.get_op_type() == tiramisu::o_access) &&
+        (e.get_name() == name))
+    {
+        bool found = false;
+        for (const auto &access : accesses)
+            found = found || access.is_equal(e);
+        if (!found)
+            accesses.push_back(e);
+    }
+
+    e.apply_to_operands([&name, &accesses](const tiramisu::expr &operand)
+    {
+        collect_accesses_to_computation(operand, name, accesses);
+        return operand;
+    });
+}
+
+/**
+  * Return true if the iterator \p name is used in \p e.
+  */
+static bool expr_uses_iterator(const tiramisu::expr &e, const std::string &name)
+{
+    if ((e.get_expr_type() == tiramisu::e_var) && (e.get_name() == name))
+        return true;
+
+    bool used = false;
+    e.apply_to_operands([&name, &used](const tiramisu::expr &operand)
+    {
+        used = used || expr_uses_iterator(operand, name);
+        return operand;
+    });
+
+    return used;
+}
+
+/**
+  * Return true if \p e contains an access.
+  */
+static bool expr_contains_access(const tiramisu::expr &e)
+{
+    if ((e.get_expr_type() == tiramisu::e_op) && (e.get_op_type() == tiramisu::o_access))
+        return true;
+
+    bool found = false;
+    e.apply_to_operands([&found](const tiramisu::expr &operand)
+    {
+        found = found || expr_contains_access(operand);
+        return operand;
+    });
+
+    return found;
+}
+
+/**
+  * Return true if the iterator \p name is multiplied by another expression in \p e.
+  */
+static bool expr_multiplies_iterator(const tiramisu::expr &e, const std::string &name)
+{
+    if ((e.get_expr_type() == tiramisu::e_op) && (e.get_op_type() == tiramisu::o_mul) &&
+        expr_uses_iterator(e, name))
+        return true;
+
+    bool found = false;
+    e.apply_to_operands([&name, &found](const tiramisu::expr &operand)
+    {
+        found = found || expr_multiplies_iterator(operand, name);
+        return operand;
+    });
+
+    return found;
+}
+
+/**
+  * Return \p e where the iterator \p name is replaced by (name + distance).
+  */
+static tiramisu::expr shift_iterator_in_expr(const tiramisu::expr &e, const std::string &name, int distance)
+{
+    if ((e.get_expr_type() == tiramisu::e_var) && (e.get_name() == name))
+        return tiramisu::expr(tiramisu::o_add, e,
+                              tiramisu::expr(tiramisu::o_cast, e.get_data_type(), tiramisu::expr(distance)));
+
+    return e.apply_to_operands([&name, distance](const tiramisu::expr &operand)
+    {
+        return shift_iterator_in_expr(operand, name, distance);
+    });
+}
+
+void computation::prefetch(computation &input, tiramisu::var L_var, int distance)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L_var.get_name().length() > 0);
+    assert(distance > 0);
+
+    std::vector<std::string> dim_names = this->get_iteration_domain_dimension_names();
+    if (std::find(dim_names.begin(), dim_names.end(), L_var.get_name()) == dim_names.end())
+    {
+        ERROR("The loop level " + L_var.get_name() + " passed to prefetch() is not a dimension of the iteration domain of " +
+              this->get_name() + ".", true);
+    }
+
+    std::vector<tiramisu::expr> accesses;
+    collect_accesses_to_computation(this->get_expr(), input.get_name(), accesses);
+    if (accesses.empty())
+    {
+        DEBUG(3, tiramisu::str_dump("The computation " + this->get_name() + " does not read " +
+                                    input.get_name() + ". Nothing to prefetch."));
+        DEBUG_INDENT(-4);
+        return;
+    }
+
+    // The prefetches are executed in the innermost loop level of the
+    // computation, unless it is vectorized.
+    int level = this->get_loop_levels_number() - 1;
+    if ((level > 0) && this->get_function()->should_vectorize(this->get_name(), level))
+    {
+        level--;
+    }
+
+    // The prefetches are only executed in the iterations i for which the
+    // iteration i + distance exists.  The indices of an indirect access
+    // (B(i + distance) in A(B(i + distance))) are real loads, so they must
+    // not read out of the bounds of their buffer.
+    std::string shift_map = "{" + this->get_name() + "[";
+    for (int i = 0; i < dim_names.size(); i++)
+    {
+        shift_map += dim_names[i] + ((i < dim_names.size() - 1) ? "," : "");
+    }
+    shift_map += "] -> " + this->get_name() + "[";
+    for (int i = 0; i < dim_names.size(); i++)
+    {
+        shift_map += dim_names[i];
+        if (dim_names[i] == L_var.get_name())
+        {
+            shift_map += " - " + std::to_string(distance);
+        }
+        shift_map += (i < dim_names.size() - 1) ? "," : "";
+    }
+    shift_map += "]}";
+
+    isl_set *guarded_domain = isl_set_apply(isl_set_copy(this->get_iteration_domain()),
+                                            isl_map_read_from_str(this->get_ctx(), shift_map.c_str()));
+    guarded_domain = isl_set_intersect(isl_set_copy(this->get_iteration_domain()), guarded_domain);
+
+    DEBUG(3, tiramisu::str_dump("Iterations that prefetch: ", isl_set_to_str(guarded_domain)));
+
+    for (const auto &access : accesses)
+    {
+        std::string prefetch_name = "_prefetch_" + this->get_name() + "_" + generate_new_computation_name();
+
+        isl_set *domain = isl_set_copy(guarded_domain);
+        domain = isl_set_set_tuple_name(domain, prefetch_name.c_str());
+
+        // The prefetch computation takes the linear index of the prefetched
+        // element in the buffer of the input.  It is lowered to the prefetch
+        // intrinsic of Halide.
+        tiramisu::expr shifted_access = shift_iterator_in_expr(access, L_var.get_name(), distance);
+        tiramisu::expr index(tiramisu::o_lin_index, input.get_name(), shifted_access.get_access(),
+                             input.get_data_type());
+
+        DEBUG(3, tiramisu::str_dump("Prefetching " + shifted_access.to_str() + " in the computation " + prefetch_name));
+
+        computation *prefetch_comp = new computation(isl_set_to_str(domain), index, true,
+                                                     input.get_data_type(), this->get_function());
+
+        prefetch_comp->_is_library_call = true;
+        prefetch_comp->library_call_name = "tiramisu_prefetch";
+        prefetch_comp->library_call_args.resize(1);
+        prefetch_comp->rhs_argument_idx = 0;
+
+        // The prefetch follows the schedule of this computation.
+        isl_map *sched = isl_map_copy(this->get_schedule());
+        sched = isl_map_set_tuple_name(sched, isl_dim_in, prefetch_name.c_str());
+        sched = isl_map_set_tuple_name(sched, isl_dim_out, prefetch_name.c_str());
+        sched = isl_map_intersect_domain(sched, domain);
+        prefetch_comp->set_schedule(sched);
+
+        prefetch_comp->after(*this, level);
+    }
+
+    isl_set_free(guarded_domain);
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::prefetch_automatically(int distance)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    std::vector<std::string> dim_names = this->get_iteration_domain_dimension_names();
+    assert(!dim_names.empty());
+    std::string innermost = dim_names.back();
+
+    // Collect the names of the inputs that are accessed indirectly or with a stride.
+    std::vector<tiramisu::expr> accesses;
+    std::function<void(const tiramisu::expr &)> collect_all_accesses = [&](const tiramisu::expr &e)
+    {
+        if ((e.get_expr_type() == tiramisu::e_op) && (e.get_op_type() == tiramisu::o_access))
+            accesses.push_back(e);
+        e.apply_to_operands([&collect_all_accesses](const tiramisu::expr &operand)
+        {
+            collect_all_accesses(operand);
+            return operand;
+        });
+    };
+    collect_all_accesses(this->get_expr());
+
+    std::vector<std::string> inputs;
+    for (const auto &access : accesses)
+    {
+        const std::vector<tiramisu::expr> &indices = access.get_access();
+        bool indirect = false;
+        bool strided = false;
+        for (int i = 0; i < indices.size(); i++)
+        {
+            indirect = indirect || expr_contains_access(indices[i]);
+            if (i < (int) indices.size() - 1)
+                strided = strided || expr_uses_iterator(indices[i], innermost);
+            else
+                strided = strided || expr_multiplies_iterator(indices[i], innermost);
+        }
+
+        if ((indirect || strided) && (access.get_name() != this->get_name()) &&
+            (std::find(inputs.begin(), inputs.end(), access.get_name()) == inputs.end()))
+        {
+            DEBUG(3, tiramisu::str_dump("The access " + access.to_str() + " is " +
+                                        (indirect ? "indirect" : "strided") + "."));
+            inputs.push_back(access.get_name());
+        }
+    }
+
+    for (const auto &name : inputs)
+    {
+        std::vector<computation *> input = this->get_function()->get_computation_by_name(name);
+        assert(!input.empty());
+        this->prefetch(*input[0], tiramisu::var(innermost, false), distance);
+    }
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::shift(tiramisu::var L0_var, int n)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0_var.get_name().length() > 0);
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+    int L0 = dimensions[0];
+
+    this->shift(L0, n);
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::shift(int L0, int n)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    int dim0 = loop_level_into_dynamic_dimension(L0);
+
+    assert(this->get_schedule() != NULL);
+    assert(dim0 >= 0);
+    assert(dim0 < isl_space_dim(isl_map_get_space(this->get_schedule()), isl_dim_out));
+
+
+    DEBUG(3, tiramisu::str_dump("Creating a schedule that shifts the loop level ");
+          tiramisu::str_dump(std::to_string(L0));
+          tiramisu::str_dump(" of the computation ");
+          tiramisu::str_dump(this->get_name());
+          tiramisu::str_dump(" by ");
+          tiramisu::str_dump(std::to_string(n)));
+
+    this->get_function()->align_schedules();
+    assert(this->get_schedule() != NULL);
+
+    DEBUG(3, tiramisu::str_dump("Original schedule: ",
+                                isl_map_to_str(this->get_schedule())));
+
+    isl_map *new_sched = isl_map_copy(this->get_schedule());
+    new_sched = add_eq_to_schedule_map(dim0, -1, -1, n, new_sched);
+    this->set_schedule(new_sched);
+    DEBUG(3, tiramisu::str_dump("Schedule after shifting: ",
+                                isl_map_to_str(this->get_schedule())));
+
+    DEBUG_INDENT(-4);
+}
+
+isl_set *computation::simplify(isl_set *set)
+{
+    set = this->intersect_set_with_context(set);
+    set = isl_set_coalesce(set);
+    set = isl_set_remove_redundancies(set);
+
+    return set;
+}
+
+isl_map *computation::simplify(isl_map *map)
+{
+    map = this->intersect_map_domain_with_context(map);
+    map = isl_map_coalesce(map);
+
+    return map;
+}
+
+isl_set *computation::intersect_set_with_context(isl_set *set)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    // Unify the space of the context and the "missing" set so that we can intersect them.
+    isl_set *context = isl_set_copy(this->get_function()->get_program_context());
+    if (context != NULL)
+    {
+        isl_space *model = isl_set_get_space(isl_set_copy(context));
+        set = isl_set_align_params(set, isl_space_copy(model));
+        DEBUG(10, tiramisu::str_dump("Context: ", isl_set_to_str(context)));
+        DEBUG(10, tiramisu::str_dump("Set after aligning its parameters with the context parameters: ",
+                                     isl_set_to_str (set)));
+
+        isl_id *missing_id1 = NULL;
+        if (isl_set_has_tuple_id(set) == isl_bool_true)
+        {
+            missing_id1 = isl_set_get_tuple_id(set);
+        }
+        else
         {
             std::string name = isl_set_get_tuple_name(set);
             assert(name.size() > 0);
@@ -4196,7 +4946,7 @@ std::vector<int> get_shift_degrees(isl_set *missing, int L)
                                         c)));
     }
 
-    if (ENABLE_DEBUG && DEBUG_LEVEL >= 3)
+    if (DEBUG_ENABLED(3))
     {
         DEBUG_NO_NEWLINE(3, tiramisu::str_dump("Shift degrees are: "));
         for (auto c : shifts)
@@ -5359,23 +6109,119 @@ void computation::split(int L0, int sizeX)
     DEBUG_INDENT(-4);
 }
 
-// Function for the buffer class
-
-std::string str_tiramisu_type_op(tiramisu::op_t type)
+void computation::overlapped_split(int L0, int sizeX, int offset)
 {
-    switch (type)
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    int inDim0 = loop_level_into_dynamic_dimension(L0);
+
+    assert(this->get_schedule() != NULL);
+    assert(inDim0 >= 0);
+    assert(inDim0 < isl_space_dim(isl_map_get_space(this->get_schedule()), isl_dim_out));
+    assert(sizeX >= 1);
+
+    isl_map *schedule = this->get_schedule();
+    int duplicate_ID = isl_map_get_static_dim(schedule, 0);
+
+    schedule = isl_map_copy(schedule);
+    schedule = isl_map_set_tuple_id(schedule, isl_dim_out,
+                                    isl_id_alloc(this->get_ctx(), this->get_name().c_str(), NULL));
+
+    DEBUG(3, tiramisu::str_dump("Original schedule: ", isl_map_to_str(schedule)));
+    DEBUG(3, tiramisu::str_dump("Splitting dimension " + std::to_string(inDim0)
+                                + " with split size " + std::to_string(sizeX) + " and offset "
+                                + std::to_string(offset)));
+
+    std::string outDim0_str = generate_new_variable_name();
+    std::string static_dim_str = generate_new_variable_name();
+    std::string outDim1_str = generate_new_variable_name();
+
+    int n_dims = isl_map_dim(this->get_schedule(), isl_dim_out);
+    std::vector<std::string> dimensions_str;
+    std::vector<std::string> out_dimensions_str;
+
+    for (int i = 0; i < n_dims; i++)
     {
-    case tiramisu::o_logical_and:
-        return "and";
-    case tiramisu::o_logical_or:
-        return "or";
-    case tiramisu::o_max:
-        return "max";
-    case tiramisu::o_min:
-        return "min";
-    case tiramisu::o_minus:
-        return "minus";
-    case tiramisu::o_add:
+        dimensions_str.push_back(generate_new_variable_name());
+
+        if (i != inDim0)
+        {
+            out_dimensions_str.push_back(dimensions_str[i]);
+        }
+        else
+        {
+            out_dimensions_str.push_back(outDim0_str);
+            out_dimensions_str.push_back(static_dim_str);
+            out_dimensions_str.push_back(outDim1_str);
+        }
+    }
+
+    std::string map = "{" + this->get_name() + "[";
+    for (int i = 0; i < dimensions_str.size(); i++)
+    {
+        map = map + dimensions_str[i] + ((i != dimensions_str.size() - 1) ? "," : "");
+    }
+    map = map + "] -> " + this->get_name() + "[";
+    for (int i = 0; i < out_dimensions_str.size(); i++)
+    {
+        map = map + out_dimensions_str[i] + ((i != out_dimensions_str.size() - 1) ? "," : "");
+    }
+
+    // The inner dimension is equal to the original dimension, and the original
+    // dimension belongs to the tile outDim0 if it is in
+    // [sizeX*outDim0 - offset, sizeX*outDim0 + sizeX - 1 - offset].  Each
+    // iteration belongs to a single tile, so the schedule stays single-valued.
+    std::string inDim0_str = dimensions_str[inDim0];
+    std::string shifted_str = inDim0_str + " + (" + std::to_string(offset) + ")";
+    map = map + "] : " + dimensions_str[0] + " = " + std::to_string(duplicate_ID) + " and " +
+          static_dim_str + " = 0 and " + outDim1_str + " = " + inDim0_str + " and " +
+          std::to_string(sizeX) + "*" + outDim0_str + " <= " + shifted_str + " and " +
+          shifted_str + " <= " + std::to_string(sizeX) + "*" + outDim0_str + " + " +
+          std::to_string(sizeX - 1) + "}";
+
+    isl_map *transformation_map = isl_map_read_from_str(this->get_ctx(), map.c_str());
+
+    for (int i = 0; i < out_dimensions_str.size(); i++)
+        transformation_map = isl_map_set_dim_id(
+                                 transformation_map, isl_dim_out, i,
+                                 isl_id_alloc(this->get_ctx(), out_dimensions_str[i].c_str(), NULL));
+
+    transformation_map = isl_map_set_tuple_id(
+                             transformation_map, isl_dim_in,
+                             isl_map_get_tuple_id(isl_map_copy(schedule), isl_dim_out));
+    isl_id *id_range = isl_id_alloc(this->get_ctx(), this->get_name().c_str(), NULL);
+    transformation_map = isl_map_set_tuple_id(transformation_map, isl_dim_out, id_range);
+
+    DEBUG(3, tiramisu::str_dump("Transformation map : ",
+                                isl_map_to_str(transformation_map)));
+
+    schedule = isl_map_apply_range(isl_map_copy(schedule), isl_map_copy(transformation_map));
+
+    DEBUG(3, tiramisu::str_dump("Schedule after splitting: ", isl_map_to_str(schedule)));
+
+    this->set_schedule(schedule);
+
+    DEBUG_INDENT(-4);
+}
+
+// Function for the buffer class
+
+std::string str_tiramisu_type_op(tiramisu::op_t type)
+{
+    switch (type)
+    {
+    case tiramisu::o_logical_and:
+        return "and";
+    case tiramisu::o_logical_or:
+        return "or";
+    case tiramisu::o_max:
+        return "max";
+    case tiramisu::o_min:
+        return "min";
+    case tiramisu::o_minus:
+        return "minus";
+    case tiramisu::o_add:
         return "add";
     case tiramisu::o_sub:
         return "sub";
@@ -5556,7 +6402,8 @@ tiramisu::buffer::buffer(std::string name, std::vector<tiramisu::expr> dim_sizes
                          std::string corr):
                          allocated(false), argtype(argt), auto_allocate(true),
                          automatic_gpu_copy(true), dim_sizes(dim_sizes), fct(fct),
-                         name(name), type(type), location(cuda_ast::memory_location::host)
+                         name(name), type(type), location(cuda_ast::memory_location::host),
+                         distribution_layout(tiramisu::l_row_major), distribution_applied(false)
 {
     assert(!name.empty() && "Empty buffer name");
     assert(fct != NULL && "Input function is NULL");
@@ -5640,7 +6487,7 @@ const std::vector<tiramisu::expr> &buffer::get_dim_sizes() const
 
 void tiramisu::buffer::dump(bool exhaustive) const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         std::cout << "Buffer \"" << this->name
                   << "\", Number of dimensions: " << this->get_n_dims()
@@ -5763,6 +6610,7 @@ void tiramisu::computation::init_computation(std::string iteration_space_str,
     access = NULL;
     stmt = Halide::Internal::Stmt();
     time_processor_domain = NULL;
+    schedule_version = 0;
     duplicate_number = 0;
     automatically_allocated_buffer = NULL;
     predicate = tiramisu::expr();
@@ -5783,9 +6631,12 @@ void tiramisu::computation::init_computation(std::string iteration_space_str,
     this->lhs_argument_idx = -1;
     this->rhs_argument_idx = -1;
     this->wait_argument_idx = -1;
+    this->rma_argument_idx = -1;
     this->_is_library_call = false;
     this->wait_access_map = nullptr;
     this->wait_index_expr = nullptr;
+    this->rma_access_map = nullptr;
+    this->rma_index_expr = nullptr;
 
     this->schedule_this_computation = schedule_this_computation;
     this->data_type = t;
@@ -5858,6 +6709,7 @@ tiramisu::computation::computation()
     this->schedule = NULL;
     this->stmt = Halide::Internal::Stmt();
     this->time_processor_domain = NULL;
+    this->schedule_version = 0;
     this->duplicate_number = 0;
 
     this->schedule_this_computation = false;
@@ -5870,9 +6722,12 @@ tiramisu::computation::computation()
     this->lhs_argument_idx = -1;
     this->rhs_argument_idx = -1;
     this->wait_argument_idx = -1;
+    this->rma_argument_idx = -1;
     this->_is_library_call = false;
     this->wait_access_map = nullptr;
     this->wait_index_expr = nullptr;
+    this->rma_access_map = nullptr;
+    this->rma_index_expr = nullptr;
 
     this->iteration_domain = NULL;
     this->name = "";
@@ -6155,6 +7010,52 @@ computation * computation::get_predecessor() {
     return reverse_graph.begin()->first;
 }
 
+bool computation::is_fused_with(computation *comp, int level)
+{
+    if ((this->get_loop_levels_number() <= level) || (comp->get_loop_levels_number() <= level))
+        return false;
+
+    tiramisu::function *fct = this->get_function();
+
+    if (fct->use_low_level_scheduling_commands)
+    {
+        // The computations share the loop levels 0 to level if their static
+        // dimensions that precede these loop levels are equal.
+        for (int l = -1; l < level; l++)
+        {
+            int dim = loop_level_into_static_dimension(l);
+            if (isl_map_get_static_dim(this->get_schedule(), dim) != isl_map_get_static_dim(comp->get_schedule(), dim))
+                return false;
+        }
+        return true;
+    }
+
+    // The computations share the loop levels 0 to level if they are connected
+    // in the scheduling graph by edges (after(), then(), ...) at the loop
+    // level level or at a deeper loop level.
+    std::unordered_set<computation *> visited = {this};
+    std::vector<computation *> to_visit = {this};
+    while (!to_visit.empty())
+    {
+        computation *current = to_visit.back();
+        to_visit.pop_back();
+        if (current == comp)
+            return true;
+
+        for (auto graph : {&fct->sched_graph, &fct->sched_graph_reversed})
+        {
+            auto edges = graph->find(current);
+            if (edges == graph->end())
+                continue;
+            for (const auto &edge : edges->second)
+                if ((edge.second >= level) && visited.insert(edge.first).second)
+                    to_visit.push_back(edge.first);
+        }
+    }
+
+    return false;
+}
+
 /**
   * Return the time-processor domain of the computation.
   * In this representation, the logical time of execution and the
@@ -6199,11 +7100,15 @@ bool tiramisu::computation::should_drop_rank_iter() const
     return this->_drop_rank_iter;
 }
 
-int tiramisu::computation::get_level_to_drop() {
+std::vector<int> tiramisu::computation::get_levels_to_drop() {
+    std::vector<int> levels;
     if (!should_drop_rank_iter()) {
-        return -1;
+        return levels;
+    }
+    for (const auto &level : this->drop_levels) {
+        levels.push_back(get_loop_level_number_from_dimension_name(level.get_name()));
     }
-    return get_loop_level_number_from_dimension_name(this->drop_level.get_name());
+    return levels;
 }
 
 /**
@@ -6288,6 +7193,13 @@ bool tiramisu::computation::operator==(tiramisu::computation comp1)
     return (this->get_name() == comp1.get_name());
 }
 
+bool tiramisu::computation::is_time_space_domain_up_to_date() const
+{
+    return (this->time_processor_domain != NULL) &&
+           (this->time_processor_domain_version ==
+            std::make_pair(this->schedule_version, this->get_function()->context_set_version));
+}
+
 /**
   * Generate the time-processor domain of the computation.
   *
@@ -6304,6 +7216,13 @@ void tiramisu::computation::gen_time_space_domain()
     assert(this->get_iteration_domain() != NULL);
     assert(this->get_schedule() != NULL);
 
+    if (this->is_time_space_domain_up_to_date())
+    {
+        DEBUG(3, tiramisu::str_dump("The time-space domain of " + this->get_name() + " is up to date."));
+        DEBUG_INDENT(-4);
+        return;
+    }
+
     DEBUG(3, tiramisu::str_dump("Iteration domain:", isl_set_to_str(this->get_iteration_domain())));
 
     isl_set *iter = isl_set_copy(this->get_iteration_domain());
@@ -6315,6 +7234,9 @@ void tiramisu::computation::gen_time_space_domain()
                                 iter,
                                 isl_map_copy(this->get_schedule()));
 
+    this->time_processor_domain_version = std::make_pair(this->schedule_version,
+                                                         this->get_function()->context_set_version);
+
     DEBUG(3, tiramisu::str_dump("Schedule:", isl_map_to_str(this->get_schedule())));
     DEBUG(3, tiramisu::str_dump("Generated time-space domain:", isl_set_to_str(time_processor_domain)));
 
@@ -6324,7 +7246,7 @@ void tiramisu::computation::gen_time_space_domain()
 void tiramisu::computation::drop_rank_iter(var level)
 {
     this->_drop_rank_iter = true;
-    this->drop_level = level;
+    this->drop_levels.push_back(level);
 }
 
 void tiramisu::computation::set_wait_access(std::string access_str) {
@@ -6547,6 +7469,11 @@ bool tiramisu::computation::is_wait() const
   return false;
 }
 
+bool tiramisu::computation::is_collective() const
+{
+  return false;
+}
+
 const std::vector<std::pair<std::string, tiramisu::expr>>
         &tiramisu::computation::get_associated_let_stmts() const
 {
@@ -6897,7 +7824,7 @@ tiramisu::constant::constant(
 
 void tiramisu::constant::dump(bool exhaustive) const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         std::cout << "Invariant \"" << this->get_name() << "\"" << std::endl;
         std::cout << "Expression: ";
@@ -7069,6 +7996,12 @@ std::string tiramisu::xfer_prop::attr_to_string(tiramisu::xfer_attr attr) {
         case CUDA: return "CUDA";
         case BLOCK: return "BLOCK";
         case NONBLOCK: return "NONBLOCK";
+        case ALLREDUCE: return "ALLREDUCE";
+        case ALLGATHER: return "ALLGATHER";
+        case BCAST: return "BCAST";
+        case ALLTOALL: return "ALLTOALL";
+        case PERSISTENT: return "PERSISTENT";
+        case RMA: return "RMA";
         default: {
             assert(false && "Unknown xfer_prop attr specified.");
             return "";
@@ -7153,11 +8086,312 @@ std::vector<communicator *> tiramisu::communicator::collapse(int level, tiramisu
     return ret;
 }
 
+void tiramisu::communicator::collapse_strided(int level, tiramisu::expr collapse_from_iter,
+                                              tiramisu::expr num_collapsed)
+{
+    // The stride should be computed before collapsing the loop level.
+    tiramisu::expr stride = this->get_loop_level_stride(level);
+    this->collapse_strided(level, collapse_from_iter, num_collapsed, stride);
+}
+
+void tiramisu::communicator::collapse_strided(int level, tiramisu::expr collapse_from_iter,
+                                              tiramisu::expr num_collapsed, tiramisu::expr stride)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(this->get_xfer_props().contains_attr(MPI) && "Strided communications are only supported with MPI.");
+
+    if (this->strided_dims.size() == 2)
+        ERROR("At most two loop levels of the communication " + this->get_name() + " can be collapsed with "
+              "collapse_strided().", true);
+
+    DEBUG(3, tiramisu::str_dump("Collapsing the loop level " + std::to_string(level) + " of " + this->get_name() +
+                                " with the stride " + stride.to_str()));
+
+    this->strided_dims.push_back({num_collapsed, stride});
+    full_loop_level_collapse(level, collapse_from_iter);
+
+    DEBUG_INDENT(-4);
+}
+
+isl_set *tiramisu::communicator::get_loop_level_access_deltas(int level, const tiramisu::buffer **buff)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    // The access from the communication to the buffer that holds the transferred data
+    isl_map *access;
+    if (this->is_send())
+    {
+        std::vector<isl_map *> accesses;
+        generator::get_rhs_accesses(this->get_function(), this, accesses, true);
+        if (accesses.size() != 1)
+        {
+            // The data of the send is not a single buffer access.
+            DEBUG(3, tiramisu::str_dump("The send " + this->get_name() + " does not access a single buffer."));
+            for (auto acc : accesses)
+                isl_map_free(acc);
+            DEBUG_INDENT(-4);
+            return NULL;
+        }
+        access = accesses[0];
+    }
+    else
+    {
+        assert(this->get_access_relation() != NULL && "The access relation of the communication should be set.");
+        access = isl_map_copy(this->get_access_relation());
+    }
+    std::string buffer_name = isl_map_get_tuple_name(access, isl_dim_out);
+    access = isl_map_apply_domain(access, isl_map_copy(this->get_trimmed_union_of_schedules()));
+
+    // Map each iteration of the loop level to the next one
+    int number_of_dimensions = isl_map_dim(access, isl_dim_in);
+    int dynamic_dimension = loop_level_into_dynamic_dimension(level) - 1;
+    assert(dynamic_dimension < number_of_dimensions);
+    std::string domain = "";
+    std::string next = "";
+    for (int i = 0; i < number_of_dimensions; i++)
+    {
+        domain += "d" + std::to_string(i);
+        next += "d" + std::to_string(i) + ((i == dynamic_dimension) ? "+1" : "");
+        if (i < number_of_dimensions - 1)
+        {
+            domain += ",";
+            next += ",";
+        }
+    }
+    std::string tuple_name = isl_map_get_tuple_name(access, isl_dim_in);
+    std::string shift_str = "{" + tuple_name + "[" + domain + "]->" + tuple_name + "[" + next + "]}";
+    isl_map *shift = isl_map_read_from_str(this->get_ctx(), shift_str.c_str());
+
+    // The difference between the buffer elements accessed by two consecutive iterations
+    isl_map *consecutive = isl_map_apply_range(isl_map_reverse(isl_map_copy(access)), shift);
+    consecutive = isl_map_apply_range(consecutive, access);
+    isl_set *deltas = isl_set_coalesce(isl_map_deltas(consecutive));
+    DEBUG(3, tiramisu::str_dump("Access deltas of the loop level:"); isl_set_dump(deltas));
+
+    *buff = this->get_function()->get_buffers().find(buffer_name)->second;
+    assert((*buff)->get_dim_sizes().size() == isl_set_dim(deltas, isl_dim_set));
+
+    DEBUG_INDENT(-4);
+
+    return deltas;
+}
+
+tiramisu::expr tiramisu::communicator::get_loop_level_stride(int level)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const tiramisu::buffer *buff;
+    isl_set *deltas = this->get_loop_level_access_deltas(level, &buff);
+    if (deltas == NULL)
+        ERROR("The stride of the loop level " + std::to_string(level) + " of " + this->get_name() +
+              " cannot be computed. Provide the stride explicitly.", true);
+    const std::vector<tiramisu::expr> &sizes = buff->get_dim_sizes();
+
+    // Linearize the deltas (the innermost buffer dimension is contiguous)
+    tiramisu::expr stride = tiramisu::expr((int32_t) 0);
+    tiramisu::expr dimension_stride = tiramisu::expr((int32_t) 1);
+    for (int d = sizes.size() - 1; d >= 0; d--)
+    {
+        isl_val *delta = isl_set_plain_get_val_if_fixed(deltas, isl_dim_set, d);
+        if (delta == NULL || isl_val_is_nan(delta) == isl_bool_true || isl_val_is_int(delta) == isl_bool_false)
+            ERROR("The stride of the loop level " + std::to_string(level) + " of " + this->get_name() +
+                  " is not constant. Provide the stride explicitly.", true);
+        long delta_value = isl_val_get_num_si(delta);
+        isl_val_free(delta);
+
+        if (delta_value != 0)
+            stride = stride + tiramisu::expr((int32_t) delta_value) * dimension_stride;
+        dimension_stride = dimension_stride * tiramisu::expr(tiramisu::o_cast, p_int32, sizes[d]);
+    }
+    isl_set_free(deltas);
+
+    DEBUG(3, tiramisu::str_dump("The stride is " + stride.to_str()));
+    DEBUG_INDENT(-4);
+
+    return stride;
+}
+
+bool tiramisu::communicator::get_loop_level_constant_stride(int level, long &stride)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const tiramisu::buffer *buff;
+    isl_set *deltas = this->get_loop_level_access_deltas(level, &buff);
+    if (deltas == NULL)
+    {
+        DEBUG_INDENT(-4);
+        return false;
+    }
+    const std::vector<tiramisu::expr> &sizes = buff->get_dim_sizes();
+
+    // Linearize the deltas.  The sizes of the buffer dimensions inner to a
+    // dimension with a non-zero delta should be constant.
+    bool is_constant = true;
+    long dimension_stride = 1;
+    stride = 0;
+    for (int d = sizes.size() - 1; d >= 0 && is_constant; d--)
+    {
+        isl_val *delta = isl_set_plain_get_val_if_fixed(deltas, isl_dim_set, d);
+        if (delta == NULL || isl_val_is_nan(delta) == isl_bool_true || isl_val_is_int(delta) == isl_bool_false)
+        {
+            is_constant = false;
+        }
+        else if (isl_val_get_num_si(delta) != 0)
+        {
+            if (dimension_stride <= 0)
+                is_constant = false;
+            stride += isl_val_get_num_si(delta) * dimension_stride;
+        }
+        isl_val_free(delta);
+
+        if (dimension_stride > 0 && sizes[d].get_expr_type() == tiramisu::e_val)
+            dimension_stride *= sizes[d].get_int_val();
+        else
+            dimension_stride = 0;
+    }
+    isl_set_free(deltas);
+
+    DEBUG(3, if (is_constant) tiramisu::str_dump("The stride is " + std::to_string(stride));
+             else tiramisu::str_dump("The stride is not constant."));
+    DEBUG_INDENT(-4);
+
+    return is_constant;
+}
+
+bool tiramisu::communicator::get_loop_level_constant_bounds(int level, long &lower_bound, long &extent)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    isl_set *iterations = isl_set_apply(isl_set_copy(this->get_iteration_domain()),
+                                        isl_map_copy(this->get_trimmed_union_of_schedules()));
+    int number_of_dimensions = isl_set_dim(iterations, isl_dim_set);
+    int dim = loop_level_into_dynamic_dimension(level) - 1;
+    assert(dim < number_of_dimensions);
+
+    // The loop level has constant bounds if the iterations are the product of the iterations
+    // of the other loop levels and of the interval of the loop level.
+    isl_set *others = isl_set_eliminate(isl_set_copy(iterations), isl_dim_set, dim, 1);
+    isl_set *interval = isl_set_eliminate(isl_set_copy(iterations), isl_dim_set, 0, dim);
+    interval = isl_set_eliminate(interval, isl_dim_set, dim + 1, number_of_dimensions - dim - 1);
+    isl_set *product = isl_set_intersect(others, isl_set_copy(interval));
+    bool is_product = (isl_set_is_equal(product, iterations) == isl_bool_true);
+    isl_set_free(product);
+    isl_set_free(iterations);
+
+    // ... and if the interval has no hole and constant bounds
+    interval = isl_set_project_out(interval, isl_dim_set, dim + 1, number_of_dimensions - dim - 1);
+    interval = isl_set_project_out(interval, isl_dim_set, 0, dim);
+    bool is_constant = false;
+    if (is_product && isl_set_is_empty(interval) == isl_bool_false)
+    {
+        isl_set *hull = isl_set_from_basic_set(isl_set_simple_hull(isl_set_copy(interval)));
+        isl_val *lower = isl_set_plain_get_val_if_fixed(isl_set_lexmin(isl_set_copy(interval)), isl_dim_set, 0);
+        isl_val *upper = isl_set_plain_get_val_if_fixed(isl_set_lexmax(isl_set_copy(interval)), isl_dim_set, 0);
+        if (isl_set_is_equal(hull, interval) == isl_bool_true && isl_val_is_int(lower) == isl_bool_true &&
+            isl_val_is_int(upper) == isl_bool_true)
+        {
+            lower_bound = isl_val_get_num_si(lower);
+            extent = isl_val_get_num_si(upper) - lower_bound + 1;
+            is_constant = true;
+        }
+        isl_set_free(hull);
+        isl_val_free(lower);
+        isl_val_free(upper);
+    }
+    isl_set_free(interval);
+
+    DEBUG(3, if (is_constant) tiramisu::str_dump("The loop level starts at " + std::to_string(lower_bound) +
+                                                 " and has " + std::to_string(extent) + " iterations");
+             else tiramisu::str_dump("The bounds of the loop level are not constant."));
+    DEBUG_INDENT(-4);
+
+    return is_constant;
+}
+
+// Return true if the variable named var_name appears in e.
+static bool expr_uses_var(const tiramisu::expr &e, const std::string &var_name)
+{
+    if (e.get_expr_type() == tiramisu::e_var && e.get_name() == var_name)
+        return true;
+    bool uses_var = false;
+    e.apply_to_operands([&uses_var, &var_name](const tiramisu::expr &operand) {
+        uses_var = uses_var || expr_uses_var(operand, var_name);
+        return operand;
+    });
+    return uses_var;
+}
+
+bool tiramisu::communicator::is_loop_level_used_in(int level, const tiramisu::expr &e)
+{
+    const char *name = isl_map_get_dim_name(this->get_schedule(), isl_dim_out,
+                                            loop_level_into_dynamic_dimension(level));
+    std::vector<std::string> names = this->get_iteration_domain_dimension_names();
+    // Conservatively assume that a loop level that is not a dimension of the iteration domain is used.
+    if (name == NULL || std::find(names.begin(), names.end(), std::string(name)) == names.end())
+        return true;
+    return expr_uses_var(e, name);
+}
+
+bool tiramisu::communicator::is_collapsed() const
+{
+    return !this->dims.empty() || !this->strided_dims.empty();
+}
+
+const std::vector<std::pair<tiramisu::expr, tiramisu::expr>> &tiramisu::communicator::get_strided_dims() const
+{
+    return this->strided_dims;
+}
+
+void tiramisu::communicator::add_strided_library_call_args(int first_argument_idx)
+{
+    if (this->strided_dims.empty())
+        return;
+
+    if (this->get_xfer_props().contains_attr(PERSISTENT))
+        ERROR("The persistent communication " + this->get_name() + " cannot be collapsed with collapse_strided().",
+              true);
+    if (this->get_xfer_props().contains_attr(RMA))
+        ERROR("The one-sided communication " + this->get_name() + " cannot be collapsed with collapse_strided().",
+              true);
+
+    // tiramisu_MPI_<fct>_<type> -> tiramisu_MPI_<fct>_strided_<type>
+    if (this->library_call_name.find("_strided_") == std::string::npos)
+        this->library_call_name.insert(this->library_call_name.rfind('_'), "_strided");
+
+    // (count, stride) of the two strided levels. The unused levels have a single element.
+    this->library_call_args.resize(first_argument_idx);
+    for (int k = 0; k < 2; k++)
+    {
+        if (k < this->strided_dims.size())
+        {
+            this->library_call_args.push_back(tiramisu::expr(tiramisu::o_cast, p_int32, this->strided_dims[k].first));
+            this->library_call_args.push_back(tiramisu::expr(tiramisu::o_cast, p_int32, this->strided_dims[k].second));
+        }
+        else
+        {
+            this->library_call_args.push_back(tiramisu::expr((int32_t) 1));
+            this->library_call_args.push_back(tiramisu::expr((int32_t) 0));
+        }
+    }
+}
+
 std::string create_send_func_name(const xfer_prop chan)
 {
     if (chan.contains_attr(MPI)) {
         std::string name = "tiramisu_MPI";
-        if (chan.contains_attr(SYNC) && chan.contains_attr(BLOCK)) {
+        if (chan.contains_attr(RMA)) {
+            assert(chan.contains_attr(BLOCK) && "A one-sided communication should be blocking.");
+            name += "_Put";
+        } else if (chan.contains_attr(PERSISTENT)) {
+            assert(chan.contains_attr(NONBLOCK) && "A persistent communication should be non-blocking.");
+            name += chan.contains_attr(SYNC) ? "_Pssend" : "_Psend";
+        } else if (chan.contains_attr(SYNC) && chan.contains_attr(BLOCK)) {
             name += "_Ssend";
         } else if (chan.contains_attr(SYNC) && chan.contains_attr(NONBLOCK)) {
             name += "_Issend";
@@ -7302,12 +8536,115 @@ void tiramisu::send::override_msg_tag(tiramisu::expr msg_tag)
     this->msg_tag = msg_tag;
 }
 
+int tiramisu::send::coalesce()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    tiramisu::recv *r = this->get_matching_recv();
+    assert(r != nullptr && "The send does not have a matching receive.");
+
+    // The non-blocking communications have one request per iteration, and the
+    // communications that were already collapsed are left as they are.
+    if (this->is_collapsed() || r->is_collapsed() || r->get_access_relation() == NULL ||
+        !this->get_xfer_props().contains_attr(BLOCK) || !r->get_xfer_props().contains_attr(BLOCK) ||
+        this->get_loop_levels_number() != r->get_loop_levels_number())
+    {
+        DEBUG(3, tiramisu::str_dump("The communication " + this->get_name() + " cannot be coalesced."));
+        DEBUG_INDENT(-4);
+        return 0;
+    }
+
+    auto iterator_value = [](long value) {
+        return (global::get_loop_iterator_data_type() == p_int32) ? tiramisu::expr((int32_t) value)
+                                                                   : tiramisu::expr((int64_t) value);
+    };
+
+    // The computations that produce the data of the send
+    std::vector<tiramisu::computation *> producers;
+    if (this->get_producer() != nullptr)
+        producers = this->get_function()->get_computation_by_name(this->get_producer()->get_name());
+
+    // Number of contiguous elements in one message
+    long count = 1;
+    int coalesced_levels = 0;
+    for (int level = this->get_loop_levels_number() - 1; level >= 0; level--)
+    {
+        // A collapsed loop level is executed in its first iteration, so the data
+        // produced in the next iterations of a loop level shared with a producer
+        // would not be computed yet.
+        bool fused_with_producer = false;
+        for (auto producer : producers)
+            fused_with_producer = fused_with_producer || this->is_fused_with(producer, level);
+        if (fused_with_producer)
+        {
+            DEBUG(3, tiramisu::str_dump("The send " + this->get_name() + " is fused with its producer at the loop level " +
+                                        std::to_string(level) + "."));
+            break;
+        }
+
+        // All the iterations of the loop level should be sent to the same rank with the same tag
+        if (this->is_loop_level_used_in(level, this->get_dest()) ||
+            this->is_loop_level_used_in(level, this->get_msg_tag()) ||
+            r->is_loop_level_used_in(level, r->get_src()) ||
+            r->is_loop_level_used_in(level, r->get_msg_tag()))
+            break;
+
+        long send_lower, send_extent, recv_lower, recv_extent, send_stride, recv_stride;
+        if (!this->get_loop_level_constant_bounds(level, send_lower, send_extent) ||
+            !r->get_loop_level_constant_bounds(level, recv_lower, recv_extent) ||
+            send_extent != recv_extent ||
+            !this->get_loop_level_constant_stride(level, send_stride) ||
+            !r->get_loop_level_constant_stride(level, recv_stride))
+            break;
+
+        if (this->get_strided_dims().empty() && send_stride == count && recv_stride == count)
+        {
+            // The data of the loop level follows the data already in the message
+            this->collapse(level, iterator_value(send_lower), tiramisu::expr((int32_t) -1),
+                           tiramisu::expr((int32_t) send_extent));
+            r->collapse(level, iterator_value(recv_lower), tiramisu::expr((int32_t) -1),
+                        tiramisu::expr((int32_t) recv_extent));
+            count *= send_extent;
+        }
+        else if (this->get_strided_dims().size() < 2 && send_stride > 0 && recv_stride > 0 &&
+                 !this->get_xfer_props().contains_attr(RMA))
+        {
+            // The data of the loop level can be described with an MPI datatype
+            this->collapse_strided(level, iterator_value(send_lower), tiramisu::expr((int32_t) send_extent),
+                                   tiramisu::expr((int32_t) send_stride));
+            r->collapse_strided(level, iterator_value(recv_lower), tiramisu::expr((int32_t) recv_extent),
+                                tiramisu::expr((int32_t) recv_stride));
+        }
+        else
+        {
+            break;
+        }
+        coalesced_levels++;
+    }
+
+    DEBUG(3, tiramisu::str_dump("Coalesced " + std::to_string(coalesced_levels) + " loop levels of " +
+                                this->get_name() + " and " + r->get_name()));
+    DEBUG_INDENT(-4);
+
+    return coalesced_levels;
+}
+
 std::string create_recv_func_name(const xfer_prop chan)
 {
 
     if (chan.contains_attr(MPI)) {
+        if (chan.contains_attr(RMA)) {
+            // The data is written by the sender and the fences around the exchange make it
+            // visible (see function::gen_rma_fences()): the receive does not call MPI.
+            assert(chan.contains_attr(BLOCK) && "A one-sided communication should be blocking.");
+            return "";
+        }
         std::string name = "tiramisu_MPI";
-        if (chan.contains_attr(BLOCK)) {
+        if (chan.contains_attr(PERSISTENT)) {
+            assert(chan.contains_attr(NONBLOCK) && "A persistent communication should be non-blocking.");
+            name += "_Precv";
+        } else if (chan.contains_attr(BLOCK)) {
             name += "_Recv";
         } else if (chan.contains_attr(NONBLOCK)) {
             name += "_Irecv";
@@ -7493,6 +8830,110 @@ void tiramisu::wait::add_definitions(std::string iteration_domain_str,
     this->updates.push_back(new_c);
 }
 
+std::string create_collective_func_name(const xfer_prop chan, tiramisu::op_t reduction_op)
+{
+    assert(chan.contains_attr(MPI) && "Collective communications are only supported with MPI.");
+
+    bool nonblock = chan.contains_attr(NONBLOCK);
+    std::string name = "tiramisu_MPI";
+    if (chan.contains_attr(ALLREDUCE)) {
+        name += nonblock ? "_Iallreduce" : "_Allreduce";
+        switch (reduction_op) {
+            case tiramisu::o_add:
+                name += "_sum";
+                break;
+            case tiramisu::o_mul:
+                name += "_prod";
+                break;
+            case tiramisu::o_max:
+                name += "_max";
+                break;
+            case tiramisu::o_min:
+                name += "_min";
+                break;
+            default:
+                ERROR("Reduction operator not allowed for an allreduce.", 27);
+        }
+    } else if (chan.contains_attr(ALLGATHER)) {
+        name += nonblock ? "_Iallgather" : "_Allgather";
+    } else if (chan.contains_attr(BCAST)) {
+        name += nonblock ? "_Ibcast" : "_Bcast";
+    } else if (chan.contains_attr(ALLTOALL)) {
+        name += nonblock ? "_Ialltoall" : "_Alltoall";
+    } else {
+        ERROR("A collective should have one of the attributes ALLREDUCE, ALLGATHER, BCAST or ALLTOALL.", 27);
+    }
+
+    switch (chan.get_dtype()) {
+        case p_uint8:
+            name += "_uint8";
+            break;
+        case p_uint16:
+            name += "_uint16";
+            break;
+        case p_uint32:
+            name += "_uint32";
+            break;
+        case p_uint64:
+            name += "_uint64";
+            break;
+        case p_int8:
+            name += "_int8";
+            break;
+        case p_int16:
+            name += "_int16";
+            break;
+        case p_int32:
+            name += "_int32";
+            break;
+        case p_int64:
+            name += "_int64";
+            break;
+        case p_float32:
+            name += "_f32";
+            break;
+        case p_float64:
+            name += "_f64";
+            break;
+        default:
+            ERROR("Channel type not allowed.", 27);
+    }
+
+    return name;
+}
+
+tiramisu::collective::collective(std::string iteration_domain_str, tiramisu::expr rhs, xfer_prop prop,
+                                 std::vector<expr> dims, tiramisu::function *fct,
+                                 tiramisu::op_t reduction_op, tiramisu::expr root) :
+        communicator(iteration_domain_str, rhs, true, prop.get_dtype(), prop, fct),
+        reduction_op(reduction_op), root(root)
+{
+    assert(rhs.get_op_type() == tiramisu::o_access && "The RHS expression for a collective should be an access!");
+
+    _is_library_call = true;
+    library_call_name = create_collective_func_name(prop, reduction_op);
+    for (const auto &dim : dims) {
+        this->add_dim(dim);
+    }
+    expr mod_rhs(tiramisu::o_address_of, rhs.get_name(), rhs.get_access(), rhs.get_data_type());
+    set_expression(mod_rhs);
+}
+
+bool tiramisu::collective::is_collective() const
+{
+    return true;
+}
+
+tiramisu::op_t tiramisu::collective::get_reduction_op() const
+{
+    return reduction_op;
+}
+
+tiramisu::expr tiramisu::collective::get_root() const
+{
+    return root;
+}
+
 void tiramisu::computation::full_loop_level_collapse(int level, tiramisu::expr collapse_from_iter)
 {
     std::string collapse_from_iter_repr;
@@ -7666,6 +9107,73 @@ expr tiramisu::computation::get_span(int level)
     return loop_bound.simplify();
 }
 
+void tiramisu::buffer::distribute(std::vector<int> dims, std::vector<int> processor_grid, std::vector<int> block,
+                                  tiramisu::layout_t layout)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (this->distribution_applied)
+        ERROR("The buffer " + this->get_name() + " was already distributed by a previous call to codegen().", true);
+
+    assert(!dims.empty() && "At least one dimension should be distributed.");
+    assert(dims.size() == processor_grid.size() && "The process grid should have one dimension per distributed dimension.");
+
+    if (block.empty())
+    {
+        for (int dim : dims)
+        {
+            assert(dim >= 0 && dim < this->get_n_dims());
+            if (this->get_dim_sizes()[dim].get_expr_type() != tiramisu::e_val)
+                ERROR("The extent of the dimension " + std::to_string(dim) + " of the buffer " + this->get_name() +
+                      " is not constant. Provide the number of elements to partition.", true);
+            block.push_back(this->get_dim_sizes()[dim].get_int_val());
+        }
+    }
+    assert(dims.size() == block.size() && "The number of partitioned elements should be given for each distributed dimension.");
+
+    for (int k = 0; k < dims.size(); k++)
+    {
+        assert(dims[k] >= 0 && dims[k] < this->get_n_dims());
+        assert(processor_grid[k] > 0 && block[k] > 0);
+        DEBUG(3, tiramisu::str_dump("The dimension " + std::to_string(dims[k]) + " of " + this->get_name() + " (" +
+                                    std::to_string(block[k]) + " elements) is distributed on " +
+                                    std::to_string(processor_grid[k]) + " ranks."));
+    }
+
+    this->distributed_dimensions = dims;
+    this->distribution_grid = processor_grid;
+    this->distribution_block = block;
+    this->distribution_layout = layout;
+
+    DEBUG_INDENT(-4);
+}
+
+bool tiramisu::buffer::is_distributed() const
+{
+    return !this->distributed_dimensions.empty();
+}
+
+const std::vector<int> &tiramisu::buffer::get_distributed_dimensions() const
+{
+    return this->distributed_dimensions;
+}
+
+const std::vector<int> &tiramisu::buffer::get_distribution_grid() const
+{
+    return this->distribution_grid;
+}
+
+const std::vector<int> &tiramisu::buffer::get_distribution_block() const
+{
+    return this->distribution_block;
+}
+
+tiramisu::layout_t tiramisu::buffer::get_distribution_layout() const
+{
+    return this->distribution_layout;
+}
+
 void tiramisu::buffer::tag_gpu_shared() {
     location = cuda_ast::memory_location::shared;
     set_auto_allocate(false);
@@ -7750,6 +9258,37 @@ int computation::get_distributed_dimension()
         return -1;//no distributed dimension
 }
 
+std::vector<int> computation::get_distributed_dimensions()
+{
+    this->gen_time_space_domain();
+
+    int number_of_dimensions = isl_set_dim(this->get_trimmed_time_processor_domain(), isl_dim_set);
+
+    std::vector<int> distributed_dimensions;
+    for (int i = 0; i < number_of_dimensions; i++)
+        if (this->get_function()->should_distribute(this->get_name(), i))
+            distributed_dimensions.push_back(i);
+
+    return distributed_dimensions;
+}
+
+/**
+  * Return the ISL expression of the coordinate of the rank \p rank_name
+  * along the grid dimension \p grid_dimension (or the rank itself if
+  * \p grid_dimension is -1).
+  */
+static std::string get_rank_coordinate_string(const std::string &rank_name, const tiramisu::function *fct,
+                                              int grid_dimension)
+{
+    if (grid_dimension == -1)
+        return rank_name;
+
+    int stride = fct->get_process_grid_stride(grid_dimension);
+
+    return "((floor(" + rank_name + "/" + std::to_string(stride) + ")) mod " +
+           std::to_string(fct->get_process_grid()[grid_dimension]) + ")";
+}
+
 isl_map* computation::construct_distribution_map(tiramisu::rank_t rank_type)
 {
     DEBUG_FCT_NAME(10);
@@ -7757,19 +9296,37 @@ isl_map* computation::construct_distribution_map(tiramisu::rank_t rank_type)
 
     std::vector<std::string> dimensions_names = this->get_trimmed_time_space_domain_dimension_names();
 
-    int distributed_dimension = this->get_distributed_dimension();
+    std::vector<int> distributed_dimensions = this->get_distributed_dimensions();
 
-    if (distributed_dimension == -1)
+    if (distributed_dimensions.empty())
         ERROR("Computation " + this->get_name() + "isn't tagged distributed and used gen_communication().",true);
 
-    if(distributed_dimension > 0)
-        ERROR("Generating communication code automatically for inner distributed loops is currently not supported.",true);
+    const std::vector<int> &grid = this->get_function()->get_process_grid();
+    bool use_grid = (this->get_function()->get_distributed_grid_dimension(this->get_name(),
+                                                                         distributed_dimensions[0]) != -1);
 
-    //get the extent of the distributed loop, the number od available ranks should be equal to it
-    this->simplify(this->get_iteration_domain());
-    isl_set * it_dom = this->get_trimmed_time_processor_domain();
-    project_out_static_dimensions(it_dom);
-    int number_of_ranks = tiramisu::utility::get_extent(it_dom, distributed_dimension);
+    if (!use_grid && distributed_dimensions.size() > 1)
+        ERROR("Computation " + this->get_name() + " is distributed on " + std::to_string(distributed_dimensions.size()) +
+              " loop levels. Use function::set_process_grid() to define a process grid with as many dimensions.", true);
+
+    // The number of ranks is the size of the process grid, or the extent of the
+    // distributed loop (one rank per iteration).  The iterations of the distributed
+    // loop levels are mapped to ranks through their coordinates and not through
+    // a fixed chunk size, so partial chunks (i.e., extents that are not
+    // divisible by the number of ranks) are supported.
+    int number_of_ranks = 1;
+    if (use_grid)
+    {
+        for (int ranks : grid)
+            number_of_ranks *= ranks;
+    }
+    else
+    {
+        this->simplify(this->get_iteration_domain());
+        isl_set * it_dom = this->get_trimmed_time_processor_domain();
+        project_out_static_dimensions(it_dom);
+        number_of_ranks = tiramisu::utility::get_extent(it_dom, distributed_dimensions[0]);
+    }
 
     std::string dimensions_string = "";
     for (int i = 0; i < dimensions_names.size(); i++)
@@ -7778,18 +9335,27 @@ isl_map* computation::construct_distribution_map(tiramisu::rank_t rank_type)
         if (i < dimensions_names.size()-1)
             dimensions_string += ",";
     }
-    //TODO : this won't give a correct result if distributed_stride%number_of_nodes!=0
-    //should be corrected
+
     std::string rank_name = get_rank_string_type(rank_type);
     std::string params = "[" + rank_name + "]";
     std::string ranks_definition = "0<=" + rank_name + "<" + std::to_string(number_of_ranks);
 
     std::string domain = this->get_name() + "[" + dimensions_string + "]";
 
-    std::string constraint_on_distributed_dimension = rank_name + "<=" + this->get_dimension_name_for_loop_level(distributed_dimension) + "<" + "(" + rank_name + "+1)";
+    std::string constraint_on_distributed_dimensions = "";
+    for (int k = 0; k < distributed_dimensions.size(); k++)
+    {
+        std::string coordinate = get_rank_coordinate_string(rank_name, this->get_function(), use_grid ? k : -1);
+        if (k > 0)
+            constraint_on_distributed_dimensions += " and ";
+        constraint_on_distributed_dimensions += this->get_dimension_name_for_loop_level(distributed_dimensions[k]) +
+                                                "=" + coordinate;
+    }
 
     std::string distribution_map_string = params + "->{" + domain +"->" + domain + ":"
-    + ranks_definition + " and " + constraint_on_distributed_dimension + "}";
+    + ranks_definition + " and " + constraint_on_distributed_dimensions + "}";
+
+    DEBUG(3, tiramisu::str_dump("The distribution map string is: " + distribution_map_string));
 
     isl_map* distribution_map = isl_map_read_from_str(this->get_ctx(), distribution_map_string.c_str());
 
@@ -7806,7 +9372,9 @@ std::string computation::get_comm_id(rank_t rank_type, int i)
 
 isl_set* computation::construct_comm_set(isl_set* set, rank_t rank_type, int comm_id)
 {
-    int dist_dim = this->get_distributed_dimension();
+    // The set to exchange is a subset of the iteration domain of the producer.
+    computation *producer = this->get_function()->get_computation_by_name(isl_set_get_tuple_name(set))[0];
+    std::vector<int> dist_dims = producer->get_distributed_dimensions();
 
     set = isl_set_insert_dims(set, isl_dim_set, 0, 1);
     set = isl_set_insert_dims(set, isl_dim_set, 1, 1);
@@ -7833,8 +9401,9 @@ isl_set* computation::construct_comm_set(isl_set* set, rank_t rank_type, int com
     set_parts[0] += " and " + get_rank_string_type(rank_t::r_receiver) + "'=" + get_rank_string_type(rank_t::r_receiver) + "}";
     set = isl_set_read_from_str(isl_set_get_ctx(set), set_parts[0].c_str());
 
-    //Project out the distributed dimension
-    set = isl_set_project_out(set, isl_dim_set, dist_dim + 2, 1);
+    //Project out the distributed dimensions (starting from the innermost)
+    for (int k = dist_dims.size() - 1; k >= 0; k--)
+        set = isl_set_project_out(set, isl_dim_set, dist_dims[k] + 2, 1);
 
     //Project out r_receiver from isl_dim_param
     int idx_rrcv= 0;
@@ -7927,7 +9496,8 @@ std::unordered_map<std::string, isl_set*> computation::construct_exchange_sets()
     return to_exchange_sets;
 }
 
-void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_iter_dom, int comm_id, std::string comp_name)
+xfer computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_iter_dom, int comm_id, std::string comp_name,
+                                         bool nonblocking)
 {
     //creating access_variables
     var r_snd(get_rank_string_type(rank_t::r_sender).c_str());
@@ -7944,18 +9514,25 @@ void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_it
         idx++;
     }
 
+    //The local loop levels of the producer are used to index its iteration domain
+    computation *producer = get_function()->get_computation_by_name(comp_name)[0];
+    if ((int) iterators.size() != isl_set_dim(producer->get_iteration_domain(), isl_dim_set))
+        ERROR("The local loop levels of " + comp_name + " do not match the dimensions of its iteration domain. "
+              "Communication cannot be generated for this distribution (e.g., a block-cyclic distribution).", true);
+
     //creating access
     tiramisu::expr access = tiramisu::expr(op_t::o_access, comp_name,iterators,
     get_function()->get_computation_by_name(comp_name)[0]->get_data_type());
 
     auto data_type = get_function()->get_computation_by_name(comp_name)[0]->get_data_type();
 
+    tiramisu::xfer_attr mode = nonblocking ? NONBLOCK : BLOCK;
     xfer data_transfer = computation::create_xfer(
         isl_set_to_str(send_iter_dom),
         isl_set_to_str(recv_iter_dom),
         r_rcv, r_snd,
-        xfer_prop(data_type, {MPI, BLOCK, ASYNC}),
-        xfer_prop(data_type, {MPI, BLOCK, ASYNC}),
+        xfer_prop(data_type, {MPI, mode, ASYNC}),
+        xfer_prop(data_type, {MPI, mode, ASYNC}),
         access, get_function());
 
     data_transfer.s->tag_distribute_level(r_snd);
@@ -7984,7 +9561,34 @@ void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_it
         data_transfer.r->before(*c, computation::root);
     }
 
-    //create send _access_string
+    //Each distributed loop level of the consumer is associated with a local loop level:
+    //the k-th distributed loop level is associated with the k-th loop level that follows
+    //the last distributed loop level.  The data received from a rank that has a different
+    //coordinate along a distributed loop level is stored after the local data along the
+    //associated loop level.
+    std::vector<int> distributed_dimensions = this->get_distributed_dimensions();
+    int number_of_distributed_dimensions = distributed_dimensions.size();
+    int first_associated_level = distributed_dimensions.back() + 1 - number_of_distributed_dimensions;
+    if (first_associated_level + number_of_distributed_dimensions > (int) iterators.size())
+        ERROR("Each distributed loop level of " + this->get_name() + " should be followed by a local loop level "
+              "to store the received data.", true);
+
+    bool use_grid = (this->get_function()->get_distributed_grid_dimension(this->get_name(),
+                                                                         distributed_dimensions[0]) != -1);
+
+    //Extent of the local loop levels associated with the distributed loop levels
+    this->simplify(this->get_iteration_domain());
+    isl_set * s= this->get_trimmed_time_processor_domain();
+    project_out_static_dimensions(s);
+    for (int k = number_of_distributed_dimensions - 1; k >= 0; k--)
+        s = isl_set_project_out(s, isl_dim_set, distributed_dimensions[k], 1);
+    std::vector<int> extents;
+    for (int k = 0; k < number_of_distributed_dimensions; k++)
+        extents.push_back(tiramisu::utility::get_extent(s, first_associated_level + k));
+    isl_set_free(s);
+
+    //construct string access: one disjunct for each combination of the distributed loop levels
+    //along which the sender and the receiver have different coordinates
     std::string it_string = "";
     for (int i = 0; i < iterators.size(); i++)
     {
@@ -7992,35 +9596,84 @@ void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_it
         if(i < iterators.size() - 1) it_string += ',';
     }
 
-    //Each rank will process dim_extent/nb_ranks
-    //To fix and test
-    int distributed_dimension = this->get_distributed_dimension();
-    this->simplify(this->get_iteration_domain());
-    isl_set * s= this->get_trimmed_time_processor_domain();
-    project_out_static_dimensions(s);
-    s = isl_set_project_out(s, isl_dim_set, distributed_dimension, 1);
-    int extent = tiramisu::utility::get_extent(s, distributed_dimension);
-
-    //construct string access
-    std::string access_string = "{" + get_comm_id(rank_t::r_receiver,comm_id) + "[" + get_rank_string_type(rank_t::r_receiver)
-    + "," + get_rank_string_type(rank_t::r_sender) + "," + it_string + "]->" +
-    isl_map_get_tuple_name(get_function()->get_computation_by_name(comp_name)[0]->get_access_relation(), isl_dim_out);
-    access_string += "[" + std::to_string(extent) + "+" +it_string + "]}";
-    data_transfer.r->set_access(access_string);
+    std::string buffer_name = isl_map_get_tuple_name(get_function()->get_computation_by_name(comp_name)[0]->get_access_relation(), isl_dim_out);
+    std::string access_string = "{";
+    for (int mask = 1; mask < (1 << number_of_distributed_dimensions); mask++)
+    {
+        std::string constraints = "";
+        std::vector<std::string> index(iterators.size());
+        for (int i = 0; i < iterators.size(); i++)
+            index[i] = iterators[i].get_name();
 
-    /***This works only for outermost loops***/
-    //To do: make it work on any level
-    //Important : get_bound doesn't work for dim more than one, that's why we project out all other dim
-    recv_iter_dom = isl_set_project_out(recv_iter_dom, isl_dim_set, 0, 2);
+        for (int k = 0; k < number_of_distributed_dimensions; k++)
+        {
+            std::string receiver_coordinate = get_rank_coordinate_string(get_rank_string_type(rank_t::r_receiver), this->get_function(), use_grid ? k : -1);
+            std::string sender_coordinate = get_rank_coordinate_string(get_rank_string_type(rank_t::r_sender), this->get_function(), use_grid ? k : -1);
+            if (k > 0)
+                constraints += " and ";
+            if (mask & (1 << k))
+            {
+                constraints += "(" + receiver_coordinate + "<" + sender_coordinate + " or " +
+                               receiver_coordinate + ">" + sender_coordinate + ")";
+                index[first_associated_level + k] = std::to_string(extents[k]) + "+" + index[first_associated_level + k];
+            }
+            else
+            {
+                constraints += receiver_coordinate + "=" + sender_coordinate;
+            }
+        }
+
+        std::string index_string = "";
+        for (int i = 0; i < index.size(); i++)
+        {
+            index_string += index[i];
+            if (i < index.size() - 1) index_string += ',';
+        }
+
+        if (mask > 1)
+            access_string += ";";
+        access_string += get_comm_id(rank_t::r_receiver,comm_id) + "[" + get_rank_string_type(rank_t::r_receiver)
+        + "," + get_rank_string_type(rank_t::r_sender) + "," + it_string + "]->" + buffer_name
+        + "[" + index_string + "] : " + constraints;
+    }
+    access_string += "}";
+    DEBUG(3, tiramisu::str_dump("Access of the receive: " + access_string));
+    data_transfer.r->set_access(access_string);
 
     //adapt buffer size
-    int additional_space = tiramisu::utility::get_extent(recv_iter_dom, 0);
+    tiramisu::buffer *buff = this->get_function()->get_buffers().find(buffer_name)->second;
+
+    for (int k = 0; k < number_of_distributed_dimensions; k++)
+    {
+        int level = first_associated_level + k;
+
+        //Only the data received from the ranks that have a different coordinate k is stored
+        //after the local data along the associated loop level
+        std::string receiver_coordinate = get_rank_coordinate_string(get_rank_string_type(rank_t::r_receiver), this->get_function(), use_grid ? k : -1);
+        std::string sender_coordinate = get_rank_coordinate_string(get_rank_string_type(rank_t::r_sender), this->get_function(), use_grid ? k : -1);
+        std::string different_coordinate = "{" + get_comm_id(rank_t::r_receiver,comm_id) + "[" + get_rank_string_type(rank_t::r_receiver)
+        + "," + get_rank_string_type(rank_t::r_sender) + "," + it_string + "] : " + receiver_coordinate + "<" + sender_coordinate
+        + " or " + receiver_coordinate + ">" + sender_coordinate + "}";
+        isl_set *received = isl_set_intersect(isl_set_copy(recv_iter_dom),
+                                              isl_set_read_from_str(this->get_ctx(), different_coordinate.c_str()));
+
+        //Important : get_bound doesn't work for dim more than one, that's why we project out all other dim
+        received = isl_set_project_out(received, isl_dim_set, 0, 2);
+        received = isl_set_project_out(received, isl_dim_set, level + 1, isl_set_dim(received, isl_dim_set) - level - 1);
+        received = isl_set_project_out(received, isl_dim_set, 0, level);
+        if (isl_set_is_empty(received) == isl_bool_false)
+        {
+            int additional_space = tiramisu::utility::get_extent(received, 0);
 
-    tiramisu::buffer *buff = this->get_function()->get_buffers().find(isl_map_get_tuple_name(
-    get_function()->get_computation_by_name(comp_name)[0]->get_access_relation(), isl_dim_out))->second;
+            assert(level < buff->get_dim_sizes().size() && "The buffer should have a dimension for each local loop level.");
+            int size = buff->get_dim_sizes()[level].get_int_val() + additional_space;
+            buff->set_dim_size(level, size);
+        }
+        isl_set_free(received);
+    }
+    isl_set_free(recv_iter_dom);
 
-    int size = buff->get_dim_sizes()[0].get_int_val() + additional_space;
-    buff->set_dim_size(0, size);
+    return data_transfer;
 }
 
 void computation::gen_communication()
@@ -8050,6 +9703,182 @@ void computation::gen_communication()
     }
 }
 
+/**
+  * Create a wait on the non-blocking communication \p op and the buffer
+  * that stores the MPI requests of \p op.  The requests are indexed by all
+  * the dimensions of the iteration domain of \p op except the first one,
+  * which is the (distributed) rank that executes the communication.  The
+  * bounds of these dimensions should be constant.
+  */
+static tiramisu::wait *create_wait_for_communication(tiramisu::computation *op)
+{
+    isl_set *dom = op->get_iteration_domain();
+    int number_of_dimensions = isl_set_dim(dom, isl_dim_set);
+
+    std::vector<tiramisu::expr> iterators;
+    std::vector<tiramisu::expr> sizes;
+    std::string it_string = "";
+    std::string index_string = "";
+    for (int d = 0; d < number_of_dimensions; d++)
+    {
+        std::string name = isl_set_get_dim_name(dom, isl_dim_set, d);
+        iterators.push_back(tiramisu::var(name));
+        it_string += name;
+        if (d < number_of_dimensions - 1)
+            it_string += ",";
+
+        if (d == 0)
+            continue;
+
+        isl_set *projected = isl_set_copy(dom);
+        projected = isl_set_project_out(projected, isl_dim_set, d + 1, number_of_dimensions - d - 1);
+        projected = isl_set_project_out(projected, isl_dim_set, 0, d);
+        tiramisu::expr lower_bound = tiramisu::utility::get_bound(projected, 0, false);
+        tiramisu::expr upper_bound = tiramisu::utility::get_bound(projected, 0, true);
+        isl_set_free(projected);
+        if (!lower_bound.is_constant() || !upper_bound.is_constant())
+        {
+            ERROR("The bounds of the dimension " + name + " of the communication " + op->get_name() +
+                  " should be constant to allocate its requests.", true);
+        }
+        sizes.push_back((int32_t) (upper_bound.get_int_val() - lower_bound.get_int_val() + 1));
+
+        index_string += name + "-(" + std::to_string(lower_bound.get_int_val()) + ")";
+        if (d < number_of_dimensions - 1)
+            index_string += ",";
+    }
+
+    std::string buffer_name = op->get_name() + "_requests";
+    new tiramisu::buffer(buffer_name, sizes, tiramisu::p_wait_ptr, tiramisu::a_temporary, op->get_function());
+    op->set_wait_access("{" + op->get_name() + "[" + it_string + "]->" + buffer_name + "[" + index_string + "]}");
+
+    tiramisu::wait *w = new tiramisu::wait(tiramisu::expr(tiramisu::o_access, op->get_name(), iterators, op->get_data_type()),
+                                           xfer_prop(tiramisu::p_wait_ptr, {MPI}), op->get_function());
+    w->tag_distribute_level(0);
+
+    return w;
+}
+
+void computation::gen_overlapped_communication()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    tiramisu::function *fct = this->get_function();
+
+    //The boundary region: the iterations of the receiver that read data it does not own.
+    //It is computed before generating the communications since they extend the buffers.
+    isl_map* receiver_dist_map = construct_distribution_map(rank_t::r_receiver);
+    isl_set* receiver_to_compute_set = isl_set_apply(isl_set_copy(this->get_trimmed_time_processor_domain()), receiver_dist_map);
+
+    std::vector<isl_map*> rhs_accesses;
+    generator::get_rhs_accesses(fct, this, rhs_accesses, false);
+
+    isl_set *boundary = isl_set_empty(isl_set_get_space(receiver_to_compute_set));
+    for (isl_map* rhs_access : rhs_accesses)
+    {
+        std::string comp_name = isl_map_get_tuple_name(rhs_access, isl_dim_out);
+        computation* producer = fct->get_computation_by_name(comp_name)[0];
+        if (producer->get_distributed_dimension() == -1)
+        {
+            isl_map_free(rhs_access);
+            continue;
+        }
+        rhs_access = isl_map_apply_domain(rhs_access, isl_map_copy(get_trimmed_union_of_schedules()));
+        rhs_access = isl_map_apply_range(rhs_access, isl_map_copy(producer->get_trimmed_union_of_schedules()));
+        isl_map* producer_map = producer->construct_distribution_map(rank_t::r_receiver);
+        isl_set* receiver_owned = isl_set_apply(isl_set_copy(producer->get_trimmed_time_processor_domain()), producer_map);
+        rhs_access = isl_map_intersect_domain(rhs_access, isl_set_copy(receiver_to_compute_set));
+        rhs_access = isl_map_subtract_range(rhs_access, receiver_owned);
+        boundary = isl_set_union(boundary, isl_map_domain(rhs_access));
+    }
+    isl_set_free(receiver_to_compute_set);
+
+    //Project out r_receiver from isl_dim_param: the boundary of all the ranks
+    int idx_rrcv = isl_set_find_dim_by_name(boundary, isl_dim_param, get_rank_string_type(rank_t::r_receiver).c_str());
+    if (idx_rrcv >= 0)
+        boundary = isl_set_project_out(boundary, isl_dim_param, idx_rrcv, 1);
+
+    //Express the boundary region in the iteration domain
+    boundary = isl_set_apply(boundary, isl_map_reverse(isl_map_copy(get_trimmed_union_of_schedules())));
+    boundary = isl_set_coalesce(isl_set_intersect(boundary, isl_set_copy(this->get_iteration_domain())));
+    DEBUG(3, tiramisu::str_dump("Boundary region:"); isl_set_dump(boundary));
+
+    //Post the non-blocking sends and receives before the computation
+    std::vector<computation *> waits;
+    int comm_id = 0;
+    std::unordered_map<std::string, isl_set*> to_receive_sets = construct_exchange_sets();
+    for (auto set : to_receive_sets)
+    {
+        project_out_static_dimensions(set.second);
+
+        if (isl_set_is_empty(set.second)) continue;
+
+        isl_set* recv_iter_dom = construct_comm_set(isl_set_copy(set.second), rank_t::r_receiver, comm_id);
+        isl_set* send_iter_dom = construct_comm_set(set.second, rank_t::r_sender, comm_id);
+
+        xfer data_transfer = gen_communication_code(recv_iter_dom, send_iter_dom, comm_id, set.first, true);
+        waits.push_back(create_wait_for_communication(data_transfer.s));
+        waits.push_back(create_wait_for_communication(data_transfer.r));
+
+        comm_id++;
+    }
+
+    int level = computation::root_dimension;
+    if (this->get_predecessor() != nullptr)
+        level = fct->sched_graph_reversed[this][this->get_predecessor()];
+
+    //Split the computation into the interior region (this computation) and
+    //the boundary region (a new update with the same schedule)
+    std::vector<computation *> scheduled_after = waits;
+    if (isl_set_is_empty(boundary) == isl_bool_false)
+    {
+        isl_set *interior = isl_set_subtract(isl_set_copy(this->get_iteration_domain()), isl_set_copy(boundary));
+
+        this->add_definitions(isl_set_to_str(this->get_iteration_domain()),
+                              this->get_expr(),
+                              this->should_schedule_this_computation(),
+                              this->get_data_type(),
+                              fct);
+        computation &boundary_comp = this->get_last_update();
+        boundary_comp.set_schedule(isl_map_copy(this->get_schedule()));
+        if (this->get_access_relation() != NULL)
+            boundary_comp.set_access(isl_map_copy(this->get_access_relation()));
+
+        boundary_comp.add_schedule_constraint(isl_set_to_str(boundary), "");
+        this->add_schedule_constraint(isl_set_to_str(interior), "");
+        isl_set_free(interior);
+
+        scheduled_after.push_back(&boundary_comp);
+    }
+    else
+    {
+        DEBUG(3, tiramisu::str_dump("The boundary region is empty."));
+    }
+    isl_set_free(boundary);
+
+    //Schedule the waits and the boundary region right after the interior region
+    //(and before the computations that were scheduled after this computation)
+    computation *last = this;
+    for (computation *next : scheduled_after)
+    {
+        std::unordered_map<computation *, int> successors = fct->sched_graph[last];
+        for (auto &edge : successors)
+        {
+            fct->sched_graph[last].erase(edge.first);
+            fct->sched_graph_reversed[edge.first].erase(last);
+        }
+
+        next->after(*last, level);
+        for (auto &edge : successors)
+            edge.first->after(*next, edge.second);
+
+        last = next;
+    }
+
+    DEBUG_INDENT(-4);
+}
+
 computation *computation::cache_shared(computation &inp, const var &level,
                   const std::vector<int> buffer_shape,
                   const std::vector<expr> copy_offsets,
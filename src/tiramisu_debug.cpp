@@ -1,11 +1,89 @@
+#include <cstdlib>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <tiramisu/debug.h>
 
 namespace tiramisu
 {
 
 int tiramisu_indentation = 0;
 
+std::atomic<int> debug_levels_version(0);
+
+/**
+  * The runtime debugging levels: the default level and the levels of the
+  * modules that were set explicitly.
+  */
+static std::mutex debug_levels_mutex;
+static bool debug_levels_initialized = false;
+static int default_debug_level = DEBUG_LEVEL;
+static std::map<std::string, int> module_debug_levels;
+
+/**
+  * Read the debugging levels from the environment variable TIRAMISU_DEBUG_LEVEL.
+  * Should be called with debug_levels_mutex locked.
+  */
+static void init_debug_levels()
+{
+    if (debug_levels_initialized)
+        return;
+    debug_levels_initialized = true;
+
+    const char *env = std::getenv("TIRAMISU_DEBUG_LEVEL");
+    if (env == NULL)
+        return;
+
+    std::stringstream levels(env);
+    std::string entry;
+    while (std::getline(levels, entry, ','))
+    {
+        size_t equal = entry.find('=');
+        if (equal == std::string::npos)
+            default_debug_level = std::atoi(entry.c_str());
+        else
+            module_debug_levels[entry.substr(0, equal)] = std::atoi(entry.substr(equal + 1).c_str());
+    }
+}
+
+/**
+  * Return the module of the source file \p file: "src/tiramisu_core.cpp" -> "core".
+  */
+static std::string get_debug_module(const std::string &file)
+{
+    std::string module = file.substr(file.find_last_of("/\\") + 1);
+    module = module.substr(0, module.find('.'));
+    if (module.compare(0, 9, "tiramisu_") == 0)
+        module = module.substr(9);
+    return module;
+}
+
+int get_debug_level(const char *file)
+{
+    std::lock_guard<std::mutex> lock(debug_levels_mutex);
+    init_debug_levels();
+    const auto &level = module_debug_levels.find(get_debug_module(file));
+    return (level != module_debug_levels.end()) ? level->second : default_debug_level;
+}
+
+void set_debug_level(int level)
+{
+    std::lock_guard<std::mutex> lock(debug_levels_mutex);
+    init_debug_levels();
+    default_debug_level = level;
+    module_debug_levels.clear();
+    debug_levels_version++;
+}
+
+void set_debug_level(const std::string &module, int level)
+{
+    std::lock_guard<std::mutex> lock(debug_levels_mutex);
+    init_debug_levels();
+    module_debug_levels[module] = level;
+    debug_levels_version++;
+}
+
 void str_dump(const std::string &str)
 {
     std::cout << str;
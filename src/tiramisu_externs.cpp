@@ -2,6 +2,132 @@
 #ifdef WITH_MPI
 #include <mpi.h>
 #endif
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+/**
+  * A request to read the tile \p tile + 1 of a buffer in and to write the
+  * tile \p tile - 1 out (see tiramisu_stream_tile()).
+  */
+struct stream_request
+{
+    char *base;
+    int64_t buffer_bytes;
+    int64_t tile_bytes;
+    int32_t tile;
+};
+
+/**
+  * The helper thread that processes the stream requests.
+  */
+class stream_worker
+{
+public:
+    stream_worker() : busy(false), stop(false), worker(&stream_worker::run, this) {}
+
+    ~stream_worker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            stop = true;
+        }
+        cv.notify_all();
+        worker.join();
+    }
+
+    void post(const stream_request &request)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            // Only the latest request of a buffer is useful.
+            pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                         [&](const stream_request &r) { return r.base == request.base; }),
+                          pending.end());
+            pending.push_back(request);
+        }
+        cv.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [this] { return pending.empty() && !busy; });
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        while (true)
+        {
+            cv.wait(lock, [this] { return stop || !pending.empty(); });
+            if (pending.empty())
+                return;
+
+            stream_request request = pending.front();
+            pending.pop_front();
+            busy = true;
+            lock.unlock();
+            process(request);
+            lock.lock();
+            busy = false;
+            cv.notify_all();
+        }
+    }
+
+    static void process(const stream_request &r)
+    {
+        const int64_t page = sysconf(_SC_PAGESIZE);
+
+        // Read the next tile in.
+        int64_t begin = (r.tile + 1) * r.tile_bytes;
+        if (begin < r.buffer_bytes)
+        {
+            int64_t end = std::min(begin + r.tile_bytes, r.buffer_bytes);
+            int64_t first = begin - begin % page;
+            madvise(r.base + first, end - first, MADV_WILLNEED);
+            volatile char sum = 0;
+            for (int64_t i = first; i < end; i += page)
+                sum += r.base[i];
+        }
+
+        // Write the previous tile out.
+        if (r.tile >= 1)
+        {
+            begin = (r.tile - 1) * r.tile_bytes;
+            int64_t end = std::min(begin + r.tile_bytes, r.buffer_bytes);
+            int64_t first = begin - begin % page;
+            msync(r.base + first, end - first, MS_ASYNC);
+        }
+    }
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::deque<stream_request> pending;
+    bool busy;
+    bool stop;
+    std::thread worker;
+};
+
+stream_worker &get_stream_worker()
+{
+    static stream_worker worker;
+    return worker;
+}
+
+}
 
 extern "C" {
 
@@ -45,6 +171,43 @@ double *tiramisu_address_of_float64(halide_buffer_t *buffer, unsigned long index
     return &(((double*)(buffer->host))[index]);
 }
 
+halide_buffer_t *tiramisu_batch_get_buffer(void *buffers, int32_t index) {
+    return ((halide_buffer_t **)buffers)[index];
+}
+
+void *tiramisu_mmap_buffer(const char *file_name, int64_t size) {
+    int fd = open(file_name, O_RDWR | O_CREAT, 0644);
+    struct stat st;
+    if ((fd < 0) || (fstat(fd, &st) != 0) || ((st.st_size < size) && (ftruncate(fd, size) != 0))) {
+        fprintf(stderr, "Could not open the storage file %s of %lld bytes.\n", file_name, (long long) size);
+        if (fd >= 0)
+            close(fd);
+        return NULL;
+    }
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        fprintf(stderr, "Could not map the storage file %s.\n", file_name);
+        return NULL;
+    }
+    return ptr;
+}
+
+int tiramisu_munmap_buffer(void *buffer, int64_t size) {
+    tiramisu_stream_wait();
+    return munmap(buffer, size);
+}
+
+int tiramisu_stream_tile(void *base, int64_t buffer_bytes, int64_t tile_bytes, int32_t tile) {
+    get_stream_worker().post({(char *) base, buffer_bytes, tile_bytes, tile});
+    return 0;
+}
+
+int tiramisu_stream_wait() {
+    get_stream_worker().wait();
+    return 0;
+}
+
 #ifdef WITH_MPI
 void *tiramisu_address_of_wait(halide_buffer_t *buffer, unsigned long index) {
   return &(((MPI_Request*)(buffer->host))[index]);
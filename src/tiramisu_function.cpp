@@ -3,10 +3,14 @@
 #include <isl/set.h>
 #include <isl/map.h>
 #include <isl/id.h>
+#include <isl/ilp.h>
+#include <isl/val.h>
 #include <isl/constraint.h>
 #include <isl/union_map.h>
 #include <isl/union_set.h>
 #include <isl/ast_build.h>
+#include <isl/schedule.h>
+#include <isl/schedule_node.h>
 
 #include <tiramisu/debug.h>
 #include <tiramisu/core.h>
@@ -76,8 +80,11 @@ function::function(std::string name)
     this->halide_stmt = Halide::Internal::Stmt();
     this->ast = NULL;
     this->context_set = NULL;
+    this->context_set_version = 0;
     this->use_low_level_scheduling_commands = false;
     this->_needs_rank_call = false;
+    this->batched_entry_point = false;
+    this->process_grid_layout = tiramisu::l_row_major;
 
     // Allocate an ISL context.  This ISL context will be used by
     // the ISL library calls within Tiramisu.
@@ -146,6 +153,711 @@ isl_union_map *tiramisu::function::compute_dep_graph() {
     return result;
 }
 
+/**
+ * Return true if all the vectors of \p set are lexicographically
+ * non-negative (the null vector is considered non-negative).
+ */
+static bool is_lex_nonnegative(isl_set *set)
+{
+    assert(set != NULL);
+
+    isl_space *space = isl_set_get_space(set);
+    isl_set *zero = isl_set_universe(isl_space_copy(space));
+    for (int i = 0; i < isl_set_dim(set, isl_dim_set); i++)
+    {
+        zero = isl_set_fix_si(zero, isl_dim_set, i, 0);
+    }
+
+    isl_map *lex_ge = isl_map_lex_ge(space);
+    lex_ge = isl_map_intersect_range(lex_ge, zero);
+    isl_set *nonnegative = isl_map_domain(lex_ge);
+
+    bool result = (isl_set_is_subset(set, nonnegative) == isl_bool_true);
+    isl_set_free(nonnegative);
+
+    return result;
+}
+
+/**
+ * Return true if the dimension \p dim of all the vectors of \p set is 0.
+ */
+static bool is_dimension_zero(isl_set *set, int dim)
+{
+    assert(set != NULL);
+
+    isl_set *zero = isl_set_universe(isl_set_get_space(set));
+    zero = isl_set_fix_si(zero, isl_dim_set, dim, 0);
+
+    bool result = (isl_set_is_subset(set, zero) == isl_bool_true);
+    isl_set_free(zero);
+
+    return result;
+}
+
+isl_set *tiramisu::function::compute_fusion_distances(tiramisu::computation *producer,
+                                                      tiramisu::computation *consumer, int level)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(producer != NULL);
+    assert(consumer != NULL);
+    assert(level >= 0);
+
+    DEBUG(3, tiramisu::str_dump("Computing the dependence distances between " + producer->get_name() +
+                                " and " + consumer->get_name() + " up to the loop level " +
+                                std::to_string(level)));
+
+    this->align_schedules();
+
+    std::vector<isl_map *> accesses_vector;
+    generator::get_rhs_accesses(this, consumer, accesses_vector, false);
+
+    // Keep only the accesses to the producer and reverse them to get
+    // the dependences (from the producer to the consumer).
+    isl_map *deps = NULL;
+    for (auto acc : accesses_vector)
+    {
+        std::string range_name = isl_map_get_tuple_name(acc, isl_dim_out);
+
+        if (range_name == producer->get_name())
+        {
+            if (deps == NULL)
+                deps = isl_map_reverse(acc);
+            else
+                deps = isl_map_union(deps, isl_map_reverse(acc));
+        }
+        else
+        {
+            isl_map_free(acc);
+        }
+    }
+
+    if (deps == NULL)
+    {
+        DEBUG(3, tiramisu::str_dump(consumer->get_name() + " does not read " + producer->get_name()));
+        DEBUG_INDENT(-4);
+        return NULL;
+    }
+
+    deps = isl_map_intersect_domain(deps, isl_set_copy(producer->get_iteration_domain()));
+    deps = isl_map_intersect_range(deps, isl_set_copy(consumer->get_iteration_domain()));
+
+    // Transform the dependences into the time-space domain.
+    deps = isl_map_apply_domain(deps, isl_map_copy(producer->get_schedule()));
+    deps = isl_map_apply_range(deps, isl_map_copy(consumer->get_schedule()));
+    deps = consumer->simplify(deps);
+
+    std::string tuple_name = isl_map_get_tuple_name(deps, isl_dim_in);
+    deps = isl_map_set_tuple_name(deps, isl_dim_out, tuple_name.c_str());
+
+    DEBUG(3, tiramisu::str_dump("Dependences in time-space: ", isl_map_to_str(deps)));
+
+    isl_set *distances = isl_map_deltas(deps);
+
+    // Keep only the dynamic dimensions of the loop levels 0 to level.
+    int last_dim = loop_level_into_dynamic_dimension(level);
+    int nb_dims = isl_set_dim(distances, isl_dim_set);
+    assert(last_dim < nb_dims);
+
+    distances = isl_set_project_out(distances, isl_dim_set, last_dim + 1, nb_dims - last_dim - 1);
+    for (int l = level; l >= 0; l--)
+    {
+        distances = isl_set_project_out(distances, isl_dim_set,
+                                        loop_level_into_dynamic_dimension(l) - 1, 1);
+    }
+    // Remove the duplicate dimension.
+    distances = isl_set_project_out(distances, isl_dim_set, 0, 1);
+    distances = isl_set_coalesce(distances);
+
+    DEBUG(3, tiramisu::str_dump("Dependence distances: ", isl_set_to_str(distances)));
+
+    DEBUG_INDENT(-4);
+
+    return distances;
+}
+
+bool tiramisu::function::is_fusion_legal(const std::vector<tiramisu::computation *> &chain,
+                                         const std::vector<int> &levels)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(chain.size() == levels.size());
+
+    bool legal = true;
+
+    for (int j = 1; j < (int) chain.size() && legal; j++)
+    {
+        int shared_level = levels[j];
+
+        for (int i = j - 1; i >= 0 && legal; i--)
+        {
+            // chain[i] and chain[j] share the loop levels 0 to shared_level.
+            shared_level = std::min(shared_level, levels[i + 1]);
+            if (shared_level < 0)
+            {
+                break;
+            }
+
+            isl_set *distances = this->compute_fusion_distances(chain[i], chain[j], shared_level);
+            if (distances == NULL)
+            {
+                continue;
+            }
+
+            legal = is_lex_nonnegative(distances);
+
+            for (int k = 0; k <= shared_level && legal; k++)
+            {
+                bool tagged = this->should_parallelize(chain[i]->get_name(), k) ||
+                              this->should_parallelize(chain[j]->get_name(), k) ||
+                              this->should_vectorize(chain[i]->get_name(), k) ||
+                              this->should_vectorize(chain[j]->get_name(), k);
+
+                if (tagged)
+                {
+                    legal = is_dimension_zero(distances, k);
+                }
+            }
+
+            DEBUG(3, tiramisu::str_dump("Fusing " + chain[i]->get_name() + " and " + chain[j]->get_name() +
+                                        " at the loop level " + std::to_string(shared_level) + " is " +
+                                        (legal ? "legal." : "illegal.")));
+
+            isl_set_free(distances);
+        }
+    }
+
+    DEBUG_INDENT(-4);
+
+    return legal;
+}
+
+void tiramisu::function::fuse_automatically()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (this->use_low_level_scheduling_commands)
+    {
+        DEBUG(3, tiramisu::str_dump("Low level scheduling commands were used, automatic fusion is disabled."));
+        DEBUG_INDENT(-4);
+        return;
+    }
+
+    // The computations in execution order and, for each computation, the
+    // loop level at which it is scheduled after the previous one.
+    std::vector<tiramisu::computation *> chain;
+    std::vector<int> levels;
+
+    if (this->sched_graph.empty())
+    {
+        DEBUG(3, tiramisu::str_dump("No order was specified, using the declaration order."));
+
+        for (auto comp : this->get_computations())
+        {
+            if (this->starting_computations.count(comp) == 0)
+            {
+                continue;
+            }
+
+            if (!chain.empty())
+            {
+                comp->after(*chain.back(), computation::root_dimension);
+            }
+            chain.push_back(comp);
+            levels.push_back(computation::root_dimension);
+        }
+    }
+    else if (this->is_sched_graph_tree())
+    {
+        tiramisu::computation *current = *(this->starting_computations.begin());
+        chain.push_back(current);
+        levels.push_back(computation::root_dimension);
+
+        auto edges = this->sched_graph.find(current);
+        while (edges != this->sched_graph.end() && edges->second.size() == 1)
+        {
+            auto edge = *(edges->second.begin());
+            chain.push_back(edge.first);
+            levels.push_back(edge.second);
+            current = edge.first;
+            edges = this->sched_graph.find(current);
+        }
+
+        if (edges != this->sched_graph.end() && edges->second.size() > 1)
+        {
+            DEBUG(3, tiramisu::str_dump("The order of computations is not linear, automatic fusion is not applied."));
+            DEBUG_INDENT(-4);
+            return;
+        }
+    }
+    else
+    {
+        DEBUG(3, tiramisu::str_dump("The scheduling graph is not a tree, automatic fusion is not applied."));
+        DEBUG_INDENT(-4);
+        return;
+    }
+
+    for (int i = 1; i < (int) chain.size(); i++)
+    {
+        tiramisu::computation *producer = chain[i - 1];
+        tiramisu::computation *consumer = chain[i];
+
+        // Reuse gained: the number of accesses of the consumer to the producer.
+        int reuse = 0;
+        std::vector<isl_map *> accesses_vector;
+        generator::get_rhs_accesses(this, consumer, accesses_vector, false);
+        for (auto acc : accesses_vector)
+        {
+            if (std::string(isl_map_get_tuple_name(acc, isl_dim_out)) == producer->get_name())
+            {
+                reuse++;
+            }
+            isl_map_free(acc);
+        }
+
+        DEBUG(3, tiramisu::str_dump(consumer->get_name() + " accesses " + producer->get_name() + " " +
+                                    std::to_string(reuse) + " time(s)."));
+
+        if (reuse == 0)
+        {
+            continue;
+        }
+
+        // Number of shared loop levels that are parallelized or vectorized
+        // in only one of the two computations.
+        auto lost_tags = [&](int level)
+        {
+            int lost = 0;
+            for (int k = 0; k <= level; k++)
+            {
+                if (this->should_parallelize(producer->get_name(), k) !=
+                    this->should_parallelize(consumer->get_name(), k))
+                    lost++;
+                if (this->should_vectorize(producer->get_name(), k) !=
+                    this->should_vectorize(consumer->get_name(), k))
+                    lost++;
+            }
+            return lost;
+        };
+
+        int current_level = levels[i];
+        int best_level = current_level;
+        int best_score = (current_level >= 0) ? reuse * (current_level + 1) - 2 * lost_tags(current_level) : 0;
+        std::vector<int> best_shifts;
+
+        int max_level = std::min(producer->get_loop_levels_number(),
+                                 consumer->get_loop_levels_number()) - 1;
+
+        for (int L = max_level; L > current_level; L--)
+        {
+            std::vector<int> candidate_levels = levels;
+            candidate_levels[i] = L;
+
+            isl_map *original_sched = isl_map_copy(consumer->get_schedule());
+            std::vector<int> shifts(L + 1, 0);
+            int nb_shifts = 0;
+            bool legal = this->is_fusion_legal(chain, candidate_levels);
+
+            if (!legal)
+            {
+                // Try to make fusion legal by shifting the consumer so that
+                // all the distances become non-negative.
+                isl_set *distances = this->compute_fusion_distances(producer, consumer, L);
+                assert(distances != NULL);
+
+                bool shiftable = true;
+                for (int k = 0; k <= L && shiftable; k++)
+                {
+                    isl_aff *dim_k = isl_aff_var_on_domain(
+                                         isl_local_space_from_space(isl_set_get_space(distances)),
+                                         isl_dim_set, k);
+                    isl_val *min = isl_set_min_val(distances, dim_k);
+                    isl_aff_free(dim_k);
+
+                    if (isl_val_is_int(min) == isl_bool_false)
+                    {
+                        shiftable = false;
+                    }
+                    else if (isl_val_is_neg(min) == isl_bool_true)
+                    {
+                        shifts[k] = -isl_val_get_num_si(min);
+                        nb_shifts++;
+                    }
+                    isl_val_free(min);
+                }
+                isl_set_free(distances);
+
+                if (shiftable && nb_shifts > 0)
+                {
+                    for (int k = 0; k <= L; k++)
+                    {
+                        if (shifts[k] != 0)
+                        {
+                            consumer->shift(k, shifts[k]);
+                        }
+                    }
+                    legal = this->is_fusion_legal(chain, candidate_levels);
+                }
+            }
+
+            // Restore the schedule of the consumer, the best candidate is applied later.
+            consumer->set_schedule(original_sched);
+
+            if (legal)
+            {
+                int score = reuse * (L + 1) - 2 * lost_tags(L) - nb_shifts;
+
+                DEBUG(3, tiramisu::str_dump("Fusing " + consumer->get_name() + " with " + producer->get_name() +
+                                            " at the loop level " + std::to_string(L) + " has a score of " +
+                                            std::to_string(score) + "."));
+
+                if (score > best_score)
+                {
+                    best_score = score;
+                    best_level = L;
+                    best_shifts = shifts;
+                }
+            }
+        }
+
+        if (best_level != current_level)
+        {
+            DEBUG(3, tiramisu::str_dump("Fusing " + consumer->get_name() + " with " + producer->get_name() +
+                                        " at the loop level " + std::to_string(best_level) + "."));
+
+            for (int k = 0; k < (int) best_shifts.size(); k++)
+            {
+                if (best_shifts[k] != 0)
+                {
+                    consumer->shift(k, best_shifts[k]);
+                }
+            }
+
+            consumer->after(*producer, best_level);
+            levels[i] = best_level;
+        }
+    }
+
+    this->dump_sched_graph();
+
+    DEBUG_INDENT(-4);
+}
+
+/**
+ * Return the map from the iteration domain of \p stage to the tiles of
+ * function::overlapped_tile(): along the dimension d, the iteration x
+ * belongs to the tile floor((x_d + offsets[d]) / sizes[d]).  \p region
+ * is a list of additional constraints on the iteration (on x0, x1, ...).
+ */
+static std::string get_tile_map_str(tiramisu::computation *stage, const std::vector<int> &sizes,
+                                    const std::vector<int> &offsets, const std::vector<std::string> &region)
+{
+    int nb_dims = isl_set_dim(stage->get_iteration_domain(), isl_dim_set);
+
+    std::string domain = "";
+    for (int d = 0; d < nb_dims; d++)
+    {
+        domain += "x" + std::to_string(d) + ((d < nb_dims - 1) ? "," : "");
+    }
+
+    std::string tiles = "";
+    std::string constraints = "";
+    for (int d = 0; d < sizes.size(); d++)
+    {
+        std::string t = "t" + std::to_string(d);
+        std::string shifted = "x" + std::to_string(d) + " + (" + std::to_string(offsets[d]) + ")";
+        std::string size = std::to_string(sizes[d]);
+
+        tiles += t + ((d < sizes.size() - 1) ? "," : "");
+        constraints += ((d > 0) ? " and " : "") + size + "*" + t + " <= " + shifted + " and " +
+                       shifted + " <= " + size + "*" + t + " + " + std::to_string(sizes[d] - 1);
+    }
+
+    for (const auto &r : region)
+    {
+        constraints += " and " + r;
+    }
+
+    return "{" + stage->get_name() + "[" + domain + "] -> [" + tiles + "] : " + constraints + "}";
+}
+
+void tiramisu::function::overlapped_tile(std::vector<tiramisu::computation *> stages, std::vector<int> sizes)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(stages.size() > 0);
+    assert(sizes.size() >= 1 && sizes.size() <= 3);
+
+    int n = sizes.size();
+
+    for (auto stage : stages)
+    {
+        assert(stage != NULL);
+        if (stage->get_loop_levels_number() < n)
+        {
+            ERROR("The computation " + stage->get_name() + " has less than " + std::to_string(n) +
+                  " loop levels and cannot be tiled.", true);
+        }
+    }
+
+    // halo_lower[k][d] (resp. halo_upper[k][d]) is the number of elements that
+    // stages[k] has to compute before (resp. after) each tile in the dimension d.
+    std::vector<std::vector<int>> halo_lower(stages.size(), std::vector<int>(n, 0));
+    std::vector<std::vector<int>> halo_upper(stages.size(), std::vector<int>(n, 0));
+
+    for (int c = stages.size() - 1; c > 0; c--)
+    {
+        std::vector<isl_map *> accesses_vector;
+        generator::get_rhs_accesses(this, stages[c], accesses_vector, false);
+
+        for (auto acc : accesses_vector)
+        {
+            std::string producer_name = isl_map_get_tuple_name(acc, isl_dim_out);
+
+            for (int p = 0; p < c; p++)
+            {
+                if (stages[p]->get_name() != producer_name)
+                {
+                    continue;
+                }
+
+                // Compute the offsets (producer index - consumer index) of the
+                // access on the tiled dimensions.
+                isl_map *offsets_map = isl_map_copy(acc);
+                offsets_map = isl_map_project_out(offsets_map, isl_dim_in, n,
+                                                  isl_map_dim(offsets_map, isl_dim_in) - n);
+                offsets_map = isl_map_project_out(offsets_map, isl_dim_out, n,
+                                                  isl_map_dim(offsets_map, isl_dim_out) - n);
+                offsets_map = isl_map_set_tuple_name(offsets_map, isl_dim_in, producer_name.c_str());
+                isl_set *offsets = isl_map_deltas(offsets_map);
+
+                DEBUG(3, tiramisu::str_dump("Offsets of the accesses of " + stages[c]->get_name() +
+                                            " to " + producer_name + ": ", isl_set_to_str(offsets)));
+
+                for (int d = 0; d < n; d++)
+                {
+                    isl_aff *dim_d = isl_aff_var_on_domain(
+                                         isl_local_space_from_space(isl_set_get_space(offsets)),
+                                         isl_dim_set, d);
+                    isl_val *min = isl_set_min_val(offsets, dim_d);
+                    isl_val *max = isl_set_max_val(offsets, dim_d);
+                    isl_aff_free(dim_d);
+
+                    if ((isl_val_is_int(min) == isl_bool_false) || (isl_val_is_int(max) == isl_bool_false))
+                    {
+                        ERROR("Overlapped tiling requires the accesses of " + stages[c]->get_name() +
+                              " to " + producer_name + " to have constant offsets.", true);
+                    }
+
+                    int lower = std::max(0, (int) -isl_val_get_num_si(min)) + halo_lower[c][d];
+                    int upper = std::max(0, (int) isl_val_get_num_si(max)) + halo_upper[c][d];
+                    halo_lower[p][d] = std::max(halo_lower[p][d], lower);
+                    halo_upper[p][d] = std::max(halo_upper[p][d], upper);
+
+                    isl_val_free(min);
+                    isl_val_free(max);
+                }
+
+                isl_set_free(offsets);
+            }
+
+            isl_map_free(acc);
+        }
+    }
+
+    for (int k = 0; k < stages.size(); k++)
+    {
+        for (int d = 0; d < n; d++)
+        {
+            DEBUG(3, tiramisu::str_dump("Halo of " + stages[k]->get_name() + " in the dimension " +
+                                        std::to_string(d) + ": (" + std::to_string(halo_lower[k][d]) +
+                                        ", " + std::to_string(halo_upper[k][d]) + ")"));
+
+            if (halo_lower[k][d] > sizes[d] || halo_upper[k][d] > sizes[d])
+            {
+                ERROR("The halo of " + stages[k]->get_name() + " is larger than the tile size " +
+                      std::to_string(sizes[d]) + ", use larger tiles.", true);
+            }
+        }
+    }
+
+    // The tiles that contain iterations of the last stage.  The other stages
+    // are only computed in these tiles.
+    isl_map *last_tile_map = isl_map_read_from_str(this->get_isl_ctx(),
+                                 get_tile_map_str(stages.back(), sizes, std::vector<int>(n, 0), {}).c_str());
+    isl_set *tiles = isl_set_apply(isl_set_copy(stages.back()->get_iteration_domain()), last_tile_map);
+
+    // The allocations of the scratch buffers, followed by the definitions
+    // of the stages, in the order in which they are executed in a tile.
+    std::vector<tiramisu::computation *> tile_body;
+    std::vector<tiramisu::computation *> definitions;
+
+    for (int k = 0; k < stages.size(); k++)
+    {
+        // Store the intermediate stages in a scratch buffer allocated in each
+        // tile.  The window of a tile (the tile and its halo) is smaller than
+        // the size of the buffer along the tiled dimensions, so indexing the
+        // buffer modulo its size does not map two elements of a window to
+        // the same location.
+        if (k < stages.size() - 1)
+        {
+            std::vector<std::string> names = stages[k]->get_iteration_domain_dimension_names();
+            std::vector<tiramisu::expr> buffer_sizes;
+            std::vector<tiramisu::expr> buffer_indices;
+
+            for (int d = 0; d < names.size(); d++)
+            {
+                if (d < n)
+                {
+                    int window = sizes[d] + halo_lower[k][d] + halo_upper[k][d];
+                    buffer_sizes.push_back(tiramisu::expr((int32_t) window));
+                    buffer_indices.push_back(tiramisu::var(names[d], false) % tiramisu::expr((int32_t) window));
+                }
+                else
+                {
+                    int nb_dims = names.size();
+                    isl_set *projected = isl_set_copy(stages[k]->get_iteration_domain());
+                    projected = isl_set_project_out(projected, isl_dim_set, d + 1, nb_dims - d - 1);
+                    projected = isl_set_project_out(projected, isl_dim_set, 0, d);
+                    tiramisu::expr lower_bound = tiramisu::utility::get_bound(projected, 0, false);
+                    if (lower_bound.get_expr_type() != tiramisu::e_val)
+                    {
+                        ERROR("The untiled dimensions of " + stages[k]->get_name() +
+                              " should have constant bounds.", true);
+                    }
+                    buffer_sizes.push_back(tiramisu::expr((int32_t) tiramisu::utility::get_extent(projected, 0)));
+                    buffer_indices.push_back(tiramisu::var(names[d], false) - lower_bound);
+                    isl_set_free(projected);
+                }
+            }
+
+            tiramisu::buffer *scratch = new tiramisu::buffer("_" + stages[k]->get_name() + "_" +
+                                                             global::generate_new_buffer_name(),
+                                                             buffer_sizes, stages[k]->get_data_type(),
+                                                             tiramisu::a_temporary, this);
+            stages[k]->store_in(scratch, buffer_indices);
+
+            scratch->set_auto_allocate(false);
+            isl_set *allocation_domain = isl_set_set_tuple_name(isl_set_copy(tiles),
+                                                                ("_allocation_" + scratch->get_name()).c_str());
+            tile_body.push_back(new tiramisu::computation(isl_set_to_str(allocation_domain),
+                                                          tiramisu::expr(tiramisu::o_allocate, scratch->get_name()),
+                                                          true, p_none, this));
+            isl_set_free(allocation_domain);
+        }
+
+        // Split the iterations of the stage into the iterations of the tile
+        // (part 0) and of its lower (part 1) and upper (part 2) halos along
+        // each dimension.  Each combination of parts is computed by a copy of
+        // the stage that assigns each iteration to a single tile.
+        isl_map *original_schedule = isl_map_copy(stages[k]->get_schedule());
+
+        int nb_combinations = 1;
+        for (int d = 0; d < n; d++)
+        {
+            nb_combinations *= 3;
+        }
+
+        for (int combination = 0; combination < nb_combinations; combination++)
+        {
+            std::vector<int> offsets(n, 0);
+            std::vector<std::string> region;
+            bool empty = false;
+
+            for (int d = 0, parts = combination; d < n; d++, parts /= 3)
+            {
+                std::string x = "x" + std::to_string(d);
+                std::string size = std::to_string(sizes[d]);
+
+                if (parts % 3 == 1)
+                {
+                    // The last halo_lower[k][d] elements of a tile are also
+                    // computed in the next tile.
+                    empty = empty || (halo_lower[k][d] == 0);
+                    offsets[d] = halo_lower[k][d];
+                    region.push_back("(" + x + " mod " + size + ") >= " +
+                                     std::to_string(sizes[d] - halo_lower[k][d]));
+                }
+                else if (parts % 3 == 2)
+                {
+                    // The first halo_upper[k][d] elements of a tile are also
+                    // computed in the previous tile.
+                    empty = empty || (halo_upper[k][d] == 0);
+                    offsets[d] = -halo_upper[k][d];
+                    region.push_back("(" + x + " mod " + size + ") < " +
+                                     std::to_string(halo_upper[k][d]));
+                }
+            }
+
+            if (empty)
+            {
+                continue;
+            }
+
+            tiramisu::computation *definition = stages[k];
+            if (combination > 0)
+            {
+                stages[k]->add_definitions(isl_set_to_str(stages[k]->get_iteration_domain()),
+                                           stages[k]->get_expr(),
+                                           stages[k]->should_schedule_this_computation(),
+                                           stages[k]->get_data_type(), this);
+                definition = &stages[k]->get_last_update();
+                definition->set_schedule(isl_map_copy(original_schedule));
+                definition->set_access(isl_map_copy(stages[k]->get_access_relation()));
+            }
+
+            // Restrict the copy to its part of the tiles of the last stage.
+            isl_map *tile_map = isl_map_read_from_str(this->get_isl_ctx(),
+                                    get_tile_map_str(stages[k], sizes, offsets, region).c_str());
+            isl_set *part = isl_map_domain(isl_map_intersect_range(tile_map, isl_set_copy(tiles)));
+            part = isl_set_intersect(part, isl_set_copy(stages[k]->get_iteration_domain()));
+            DEBUG(3, tiramisu::str_dump("Iterations of " + stages[k]->get_name() + " computed with the offsets " +
+                                        "of the combination " + std::to_string(combination) + ": ",
+                                        isl_set_to_str(part)));
+            definition->add_schedule_constraint(isl_set_to_str(part), "");
+            isl_set_free(part);
+
+            // Split the loop levels 0 to n-1. After splitting the loop level d,
+            // the tile loop of d is at the loop level 2*d and its inner loop is
+            // at the loop level 2*d + 1.
+            for (int d = 0; d < n; d++)
+            {
+                definition->overlapped_split(2 * d, sizes[d], offsets[d]);
+            }
+
+            // Move the tile loops outermost.
+            for (int d = 1; d < n; d++)
+            {
+                for (int L = 2 * d; L > d; L--)
+                {
+                    definition->interchange(L - 1, L);
+                }
+            }
+
+            assert(isl_map_is_single_valued(definition->get_schedule()) == isl_bool_true);
+
+            tile_body.push_back(definition);
+        }
+
+        isl_map_free(original_schedule);
+
+        stages[k]->tag_parallel_level(0);
+    }
+
+    isl_set_free(tiles);
+
+    for (int c = 1; c < tile_body.size(); c++)
+    {
+        tile_body[c]->after(*tile_body[c - 1], n - 1);
+    }
+
+    DEBUG_INDENT(-4);
+}
+
 const std::map<std::string, tiramisu::buffer *> tiramisu::function::get_mapping() const
 {
   return this->mapping;
@@ -566,7 +1278,7 @@ void function::dump_trimmed_time_processor_domain() const
 {
     // Create time space domain
 
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         tiramisu::str_dump("\n\nTrimmed Time-processor domain:\n");
 
@@ -584,7 +1296,7 @@ void function::dump_time_processor_domain() const
 {
     // Create time space domain
 
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         tiramisu::str_dump("\n\nTime-processor domain:\n");
 
@@ -1006,18 +1718,220 @@ bool function::should_distribute(const std::string &comp, int lev) const
         DEBUG(10, tiramisu::str_dump("Comparing " + comp + " to " + std::get<0>(pd)));
         DEBUG(10, tiramisu::str_dump(std::get<0>(pd) + " is marked for distribution at level " + std::to_string(std::get<1>(pd))));
 
-        if ((std::get<0>(pd) == comp) && (std::get<1>(pd) == lev))
-            found = true;
+        if ((std::get<0>(pd) == comp) && (std::get<1>(pd) == lev))
+            found = true;
+    }
+
+    std::string str = "Dimension " + std::to_string(lev) +
+                      (found ? " should" : " should not")
+                      + " be distributed.";
+    DEBUG(10, tiramisu::str_dump(str));
+
+    DEBUG_INDENT(-4);
+
+    return found;
+}
+
+int function::get_distributed_grid_dimension(const std::string &comp, int lev) const
+{
+    DEBUG_FCT_NAME(10);
+    DEBUG_INDENT(4);
+
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    int grid_dimension = -1;
+
+    if (this->process_grid.size() > 1)
+    {
+        std::vector<int> levels;
+        for (const auto &pd : this->distributed_dimensions)
+            if ((std::get<0>(pd) == comp) &&
+                (std::find(levels.begin(), levels.end(), std::get<1>(pd)) == levels.end()))
+                levels.push_back(std::get<1>(pd));
+        std::sort(levels.begin(), levels.end());
+
+        auto position = std::find(levels.begin(), levels.end(), lev);
+        if ((levels.size() == this->process_grid.size()) && (position != levels.end()))
+            grid_dimension = position - levels.begin();
+    }
+
+    DEBUG(10, tiramisu::str_dump("The loop level " + std::to_string(lev) + " of " + comp +
+                                 " is distributed on the grid dimension " + std::to_string(grid_dimension)));
+
+    DEBUG_INDENT(-4);
+
+    return grid_dimension;
+}
+
+void function::set_process_grid(std::vector<int> ranks_per_dimension, tiramisu::layout_t layout)
+{
+    assert(!ranks_per_dimension.empty());
+    for (int ranks : ranks_per_dimension)
+        assert(ranks > 0 && "The number of ranks of a grid dimension should be positive.");
+
+    this->process_grid = ranks_per_dimension;
+    this->process_grid_layout = layout;
+}
+
+const std::vector<int> &function::get_process_grid() const
+{
+    return this->process_grid;
+}
+
+int function::get_process_grid_stride(int grid_dimension) const
+{
+    assert(grid_dimension >= 0 && grid_dimension < this->process_grid.size());
+
+    int stride = 1;
+    if (this->process_grid_layout == tiramisu::l_row_major)
+    {
+        for (int k = grid_dimension + 1; k < this->process_grid.size(); k++)
+            stride *= this->process_grid[k];
+    }
+    else
+    {
+        for (int k = 0; k < grid_dimension; k++)
+            stride *= this->process_grid[k];
+    }
+
+    return stride;
+}
+
+/**
+  * Return the loop level of \p comp that iterates over the dimension
+  * \p buffer_dimension of the buffer accessed by \p access (a map from the
+  * trimmed time-processor domain of \p comp to the buffer), or -1 if the
+  * buffer dimension is not equal to a loop iterator.
+  */
+static int get_loop_level_of_buffer_dimension(tiramisu::computation *comp, isl_map *access, int buffer_dimension)
+{
+    int number_of_dimensions = isl_map_dim(access, isl_dim_in);
+    int buffer_dimensions = isl_map_dim(access, isl_dim_out);
+
+    std::string domain = "";
+    for (int i = 0; i < number_of_dimensions; i++)
+        domain += "d" + std::to_string(i) + ((i < number_of_dimensions - 1) ? "," : "");
+    std::string range = "";
+    for (int i = 0; i < buffer_dimensions; i++)
+        range += "b" + std::to_string(i) + ((i < buffer_dimensions - 1) ? "," : "");
+
+    for (int level = 0; loop_level_into_dynamic_dimension(level) - 1 < number_of_dimensions; level++)
+    {
+        std::string constraint = "{" + std::string(isl_map_get_tuple_name(access, isl_dim_in)) + "[" + domain + "]->" +
+                                 std::string(isl_map_get_tuple_name(access, isl_dim_out)) + "[" + range + "]: b" +
+                                 std::to_string(buffer_dimension) + "=d" +
+                                 std::to_string(loop_level_into_dynamic_dimension(level) - 1) + "}";
+        isl_map *constraint_map = isl_map_read_from_str(comp->get_ctx(), constraint.c_str());
+        bool found = (isl_map_is_subset(access, constraint_map) == isl_bool_true);
+        isl_map_free(constraint_map);
+        if (found)
+            return level;
+    }
+
+    return -1;
+}
+
+void function::distribute_buffers()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    std::vector<tiramisu::computation *> distributed_computations;
+
+    for (const auto &b : this->get_buffers())
+    {
+        tiramisu::buffer *buf = b.second;
+        if (!buf->is_distributed())
+            continue;
+
+        // The buffer was distributed by a previous call to codegen()
+        if (buf->distribution_applied)
+        {
+            DEBUG(3, tiramisu::str_dump("The buffer " + buf->get_name() + " is already distributed."));
+            continue;
+        }
+
+        DEBUG(3, tiramisu::str_dump("Distributing the buffer " + buf->get_name()));
+
+        const std::vector<int> &dims = buf->get_distributed_dimensions();
+        const std::vector<int> &grid = buf->get_distribution_grid();
+        const std::vector<int> &block = buf->get_distribution_block();
+
+        if (dims.size() > 1)
+        {
+            if (!this->process_grid.empty() && ((this->process_grid != grid) ||
+                                                (this->process_grid_layout != buf->get_distribution_layout())))
+                ERROR("The distributed buffers of the function " + this->get_name() +
+                      " should be distributed on the same process grid.", true);
+            this->set_process_grid(grid, buf->get_distribution_layout());
+        }
+
+        // The size of the part of the buffer owned by each rank
+        std::vector<int> chunks;
+        for (int k = 0; k < dims.size(); k++)
+            chunks.push_back((block[k] + grid[k] - 1) / grid[k]);
+
+        // Owner-computes: distribute the computations that write the buffer
+        for (tiramisu::computation *comp : this->body)
+        {
+            if (comp->is_library_call() || (comp->get_access_relation() == NULL) ||
+                (isl_map_get_tuple_name(comp->get_access_relation(), isl_dim_out) != buf->get_name()))
+                continue;
+
+            comp->gen_time_space_domain();
+            isl_map *access = isl_map_apply_domain(isl_map_copy(comp->get_access_relation()),
+                                                   isl_map_copy(comp->get_trimmed_union_of_schedules()));
+            std::vector<int> levels;
+            for (int k = 0; k < dims.size(); k++)
+            {
+                int level = get_loop_level_of_buffer_dimension(comp, access, dims[k]);
+                if (level == -1)
+                    ERROR("The dimension " + std::to_string(dims[k]) + " of the distributed buffer " + buf->get_name() +
+                          " is not indexed by a loop iterator of " + comp->get_name() + ".", true);
+                if (!levels.empty() && (level <= levels.back()))
+                    ERROR("The loop levels of " + comp->get_name() + " should iterate over the distributed dimensions of "
+                          + buf->get_name() + " in the same order.", true);
+                levels.push_back(level);
+            }
+            isl_map_free(access);
+
+            // Split from the innermost loop level so that the outer loop levels are not shifted
+            for (int k = dims.size() - 1; k >= 0; k--)
+            {
+                tiramisu::var L(comp->get_dimension_name_for_loop_level(levels[k]));
+                tiramisu::var L_rank(generate_new_variable_name()), L_local(generate_new_variable_name());
+                comp->split(L, chunks[k], L_rank, L_local);
+            }
+
+            // The outer loop level of the k-th dimension is at levels[k] + k. Make the
+            // outer loop levels consecutive: each distributed loop level should be followed
+            // by the local loop levels (see gen_communication()).
+            for (int k = 1; k < dims.size(); k++)
+                for (int l = levels[k] + k; l > levels[0] + k; l--)
+                    comp->interchange(l - 1, l);
+
+            for (int k = 0; k < dims.size(); k++)
+            {
+                tiramisu::var L_rank(comp->get_dimension_name_for_loop_level(levels[0] + k));
+                comp->tag_distribute_level(L_rank);
+                comp->drop_rank_iter(L_rank);
+            }
+
+            distributed_computations.push_back(comp);
+        }
+
+        for (int k = 0; k < dims.size(); k++)
+            buf->set_dim_size(dims[k], chunks[k]);
+        buf->distribution_applied = true;
     }
 
-    std::string str = "Dimension " + std::to_string(lev) +
-                      (found ? " should" : " should not")
-                      + " be distributed.";
-    DEBUG(10, tiramisu::str_dump(str));
+    // Receive the data owned by the other ranks
+    for (tiramisu::computation *comp : distributed_computations)
+        if (comp->should_schedule_this_computation())
+            comp->gen_communication();
 
     DEBUG_INDENT(-4);
-
-    return found;
 }
 
 bool tiramisu::function::needs_rank_call() const
@@ -1025,11 +1939,34 @@ bool tiramisu::function::needs_rank_call() const
     return _needs_rank_call;
 }
 
+bool tiramisu::function::communicates_in_parallel_loops() const
+{
+    for (tiramisu::computation *comp : this->body)
+    {
+        if (!comp->is_send() && !comp->is_recv() && !comp->is_wait() && !comp->is_send_recv() &&
+            !comp->is_collective())
+            continue;
+        for (int l = 0; l < comp->get_loop_levels_number(); l++)
+        {
+            if (this->should_parallelize(comp->get_name(), l))
+                return true;
+            // The communication can also be fused into the parallel loop of
+            // another computation.
+            for (tiramisu::computation *other : this->body)
+                if ((other != comp) && this->should_parallelize(other->get_name(), l) &&
+                    comp->is_fused_with(other, l))
+                    return true;
+        }
+    }
+    return false;
+}
+
 void function::set_context_set(isl_set *context)
 {
     assert((context != NULL) && "Context is NULL");
 
     this->context_set = context;
+    this->context_set_version++;
 }
 
 void function::set_context_set(const std::string &context_str)
@@ -1038,6 +1975,7 @@ void function::set_context_set(const std::string &context_str)
 
     this->context_set = isl_set_read_from_str(this->get_isl_ctx(), context_str.c_str());
     assert((context_set != NULL) && "Context set is NULL");
+    this->context_set_version++;
 }
 
 void function::add_context_constraints(const std::string &context_str)
@@ -1055,6 +1993,45 @@ void function::add_context_constraints(const std::string &context_str)
         this->context_set = isl_set_read_from_str(this->get_isl_ctx(), context_str.c_str());
     }
     assert((context_set != NULL) && "Context set is NULL");
+    this->context_set_version++;
+}
+
+void function::add_version(const std::string &condition)
+{
+    assert((!condition.empty()) && "Condition string is empty");
+
+    isl_set *condition_set = isl_set_read_from_str(this->get_isl_ctx(), condition.c_str());
+    assert((condition_set != NULL) && "Condition set is NULL");
+
+    if (!isl_set_is_params(condition_set))
+    {
+        ERROR("The condition of a version should only constrain the parameters of the function: " +
+              condition, true);
+    }
+
+    this->version_conditions.push_back(condition_set);
+    this->version_bindings.push_back({});
+}
+
+void function::set_batched_entry_point(bool v)
+{
+    this->batched_entry_point = v;
+}
+
+void function::add_specialization(const std::map<std::string, int> &values)
+{
+    assert((!values.empty()) && "No value to specialize the function for");
+
+    std::string params;
+    std::string constraints;
+    for (const auto &value : values)
+    {
+        params += (params.empty() ? "" : ",") + value.first;
+        constraints += (constraints.empty() ? "" : " and ") + value.first + " = " + std::to_string(value.second);
+    }
+
+    this->add_version("[" + params + "]->{: " + constraints + "}");
+    this->version_bindings.back() = values;
 }
 
 /**
@@ -1123,12 +2100,25 @@ void tiramisu::function::rename_computations()
         int i = 0;
 
         if (same_name_computations.size() > 1)
+        {
+            // The AST loop types are set on the name shared by all the
+            // definitions. rename_computation() moves them to the first
+            // definition only, so copy them to the other ones.
+            std::vector<std::tuple<std::string, int, tiramisu::ast_loop_t>> loop_types;
+            for (const auto &lt : this->ast_loop_types)
+                if (std::get<0>(lt) == comp->get_name())
+                    loop_types.push_back(lt);
+
             for (auto c : same_name_computations)
             {
                 std::string new_name = "_" + c->get_name() + "_update_" + std::to_string(i);
                 c->rename_computation(new_name);
+                if (i > 0)
+                    for (const auto &lt : loop_types)
+                        this->add_ast_loop_type(new_name, std::get<1>(lt), std::get<2>(lt));
                 i++;
             }
+        }
     }
 
     DEBUG(3, tiramisu::str_dump("After renaming the computations."));
@@ -1137,6 +2127,204 @@ void tiramisu::function::rename_computations()
     DEBUG_INDENT(-4);
 }
 
+/**
+  * Return the name of the isl AST build option that corresponds to \p type.
+  */
+static std::string ast_loop_type_option_name(tiramisu::ast_loop_t type)
+{
+    switch (type)
+    {
+    case tiramisu::ast_loop_atomic:
+        return "atomic";
+    case tiramisu::ast_loop_unroll:
+        return "unroll";
+    case tiramisu::ast_loop_separate:
+        return "separate";
+    default:
+        return "";
+    }
+}
+
+/**
+  * Return the isl loop type that corresponds to \p type.
+  */
+static isl_ast_loop_type isl_ast_loop_type_from_tiramisu_type(tiramisu::ast_loop_t type)
+{
+    switch (type)
+    {
+    case tiramisu::ast_loop_atomic:
+        return isl_ast_loop_atomic;
+    case tiramisu::ast_loop_unroll:
+        return isl_ast_loop_unroll;
+    case tiramisu::ast_loop_separate:
+        return isl_ast_loop_separate;
+    default:
+        return isl_ast_loop_default;
+    }
+}
+
+/**
+  * Return true if all the dimensions of \p set starting from the dimension
+  * \p dim are fixed to a constant value.
+  */
+static bool are_dims_fixed_from(isl_set *set, int dim)
+{
+    for (int i = dim; i < isl_set_dim(set, isl_dim_set); i++)
+    {
+        isl_val *v = isl_set_plain_get_val_if_fixed(set, isl_dim_set, i);
+        bool fixed = isl_val_is_int(v);
+        isl_val_free(v);
+
+        if (!fixed)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+  * Build the subtree of the schedule tree that schedules the trimmed
+  * time-processor domains \p stmts starting from their dimension \p dim.
+  * Even dimensions are static dimensions: the statements are grouped
+  * by the value of this dimension and the groups are put in a sequence.
+  * Odd dimensions are dynamic dimensions: they become a band, unless the
+  * statements do not have any dynamic dimension left.
+  * Return NULL if a static dimension is not constant.
+  */
+static isl_schedule *build_schedule_tree(const std::vector<isl_set *> &stmts, int dim,
+                                         const std::vector<std::tuple<std::string, int, tiramisu::ast_loop_t>> &loop_types)
+{
+    assert(!stmts.empty());
+
+    int nb_dims = isl_set_dim(stmts[0], isl_dim_set);
+
+    bool fixed = true;
+    for (auto stmt : stmts)
+        fixed = fixed && are_dims_fixed_from(stmt, dim);
+
+    if ((dim >= nb_dims) || (fixed && (stmts.size() == 1)))
+    {
+        isl_union_set *domain = isl_union_set_from_set(isl_set_copy(stmts[0]));
+        for (int i = 1; i < stmts.size(); i++)
+            domain = isl_union_set_union(domain, isl_union_set_from_set(isl_set_copy(stmts[i])));
+        return isl_schedule_from_domain(domain);
+    }
+
+    if (dim % 2 == 0)
+    {
+        std::map<long, std::vector<isl_set *>> groups;
+        for (auto stmt : stmts)
+        {
+            isl_val *v = isl_set_plain_get_val_if_fixed(stmt, isl_dim_set, dim);
+            if (!isl_val_is_int(v))
+            {
+                DEBUG(3, tiramisu::str_dump("Static dimension " + std::to_string(dim) +
+                                            " is not constant in ", isl_set_to_str(stmt)));
+                isl_val_free(v);
+                return NULL;
+            }
+            groups[isl_val_get_num_si(v)].push_back(stmt);
+            isl_val_free(v);
+        }
+
+        isl_schedule *sched = NULL;
+        for (const auto &group : groups)
+        {
+            isl_schedule *child = build_schedule_tree(group.second, dim + 1, loop_types);
+            if (child == NULL)
+            {
+                isl_schedule_free(sched);
+                return NULL;
+            }
+            sched = (sched == NULL) ? child : isl_schedule_sequence(sched, child);
+        }
+        return sched;
+    }
+
+    // A dynamic dimension that has the same constant value for
+    // all the statements does not need a band.
+    if (fixed)
+    {
+        isl_val *first = isl_set_plain_get_val_if_fixed(stmts[0], isl_dim_set, dim);
+        for (int i = 1; i < stmts.size(); i++)
+        {
+            isl_val *v = isl_set_plain_get_val_if_fixed(stmts[i], isl_dim_set, dim);
+            fixed = fixed && isl_val_eq(first, v);
+            isl_val_free(v);
+        }
+        isl_val_free(first);
+    }
+
+    isl_schedule *child = build_schedule_tree(stmts, dim + 1, loop_types);
+    if ((child == NULL) || fixed)
+        return child;
+
+    isl_union_pw_aff *partial = NULL;
+    for (auto stmt : stmts)
+    {
+        isl_pw_aff *pa = isl_pw_aff_var_on_domain(
+                             isl_local_space_from_space(isl_set_get_space(stmt)), isl_dim_set, dim);
+        pa = isl_pw_aff_intersect_domain(pa, isl_set_copy(stmt));
+        isl_union_pw_aff *upa = isl_union_pw_aff_from_pw_aff(pa);
+        partial = (partial == NULL) ? upa : isl_union_pw_aff_union_add(partial, upa);
+    }
+
+    isl_schedule *sched = isl_schedule_insert_partial_schedule(child,
+                          isl_multi_union_pw_aff_from_union_pw_aff(partial));
+
+    // Set the type of the loop of the band if it was set
+    // for one of the statements at this loop level.
+    tiramisu::ast_loop_t type = tiramisu::ast_loop_default;
+    for (auto stmt : stmts)
+        for (const auto &lt : loop_types)
+            if ((std::get<0>(lt) == isl_set_get_tuple_name(stmt)) &&
+                (loop_level_into_dynamic_dimension(std::get<1>(lt)) - 1 == dim))
+                type = std::get<2>(lt);
+
+    if (type != tiramisu::ast_loop_default)
+    {
+        isl_schedule_node *band = isl_schedule_node_child(isl_schedule_get_root(sched), 0);
+        band = isl_schedule_node_band_member_set_ast_loop_type(band, 0,
+                isl_ast_loop_type_from_tiramisu_type(type));
+        isl_schedule_free(sched);
+        sched = isl_schedule_node_get_schedule(band);
+        isl_schedule_node_free(band);
+    }
+
+    return sched;
+}
+
+isl_schedule *function::gen_schedule_tree() const
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    std::vector<isl_set *> stmts;
+    for (auto comp : this->get_computations())
+        if (comp->should_schedule_this_computation())
+            stmts.push_back(comp->get_trimmed_time_processor_domain());
+
+    isl_schedule *sched = NULL;
+    if (!stmts.empty())
+        sched = build_schedule_tree(stmts, 0, this->ast_loop_types);
+
+    for (auto stmt : stmts)
+        isl_set_free(stmt);
+
+    if (sched != NULL)
+    {
+        DEBUG(3, tiramisu::str_dump("Schedule tree:", isl_schedule_to_str(sched)));
+    }
+    else
+    {
+        DEBUG(3, tiramisu::str_dump("Could not build a schedule tree."));
+    }
+
+    DEBUG_INDENT(-4);
+
+    return sched;
+}
+
 /**
   * Generate an isl AST for the function.
   */
@@ -1151,7 +2339,6 @@ void function::gen_isl_ast()
 
     isl_ctx *ctx = this->get_isl_ctx();
     assert(ctx != NULL);
-    isl_ast_build *ast_build;
 
     // Rename updates so that they have different names because
     // the code generator expects each unique name to have
@@ -1159,13 +2346,64 @@ void function::gen_isl_ast()
     // name cannot have different expressions.
     this->rename_computations();
 
-    if (this->get_program_context() == NULL)
+    isl_set *context = NULL;
+    if (this->get_program_context() != NULL)
+    {
+        context = isl_set_copy(this->get_program_context());
+    }
+
+    // The generic AST should be generated before the ASTs of the versions
+    // because the code generator of each AST leaf pushes the index
+    // expressions of its computation on a stack: gen_halide_stmt() pops
+    // them by visiting the versions in reverse order, then the generic AST.
+    this->ast = this->gen_isl_ast_from_context(context);
+
+    this->version_asts.clear();
+    for (auto condition : this->version_conditions)
+    {
+        isl_set *version_context = isl_set_copy(condition);
+        if (context != NULL)
+        {
+            version_context = isl_set_intersect(version_context, isl_set_copy(context));
+        }
+
+        DEBUG(3, tiramisu::str_dump("Generating the AST of the version:", isl_set_to_str(version_context)));
+
+        // The runtime check only needs the constraints that are not
+        // already implied by the context of the function.
+        isl_ast_build *guard_build = (context == NULL) ?
+                                     isl_ast_build_alloc(ctx) :
+                                     isl_ast_build_from_context(isl_set_copy(context));
+        isl_ast_expr *guard = isl_ast_build_expr_from_set(guard_build, isl_set_copy(condition));
+        isl_ast_build_free(guard_build);
+
+        isl_ast_node *version_ast = this->gen_isl_ast_from_context(version_context);
+        isl_set_free(version_context);
+
+        this->version_asts.push_back(std::make_pair(guard, version_ast));
+    }
+
+    isl_set_free(context);
+
+    DEBUG_INDENT(-4);
+}
+
+isl_ast_node *function::gen_isl_ast_from_context(isl_set *context)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    isl_ctx *ctx = this->get_isl_ctx();
+    isl_ast_build *ast_build;
+    isl_ast_node *result;
+
+    if (context == NULL)
     {
         ast_build = isl_ast_build_alloc(ctx);
     }
     else
     {
-        ast_build = isl_ast_build_from_context(isl_set_copy(this->get_program_context()));
+        ast_build = isl_ast_build_from_context(isl_set_copy(context));
     }
 
     isl_options_set_ast_build_atomic_upper_bound(ctx, 1);
@@ -1177,9 +2415,26 @@ void function::gen_isl_ast()
     ast_build = isl_ast_build_set_at_each_domain(ast_build, &tiramisu::generator::stmt_code_generator,
                 this);
 
+    isl_schedule *schedule_tree = NULL;
+    if (global::is_schedule_tree_codegen_set())
+    {
+        schedule_tree = this->gen_schedule_tree();
+    }
+
     // Set iterator names
     isl_id_list *iterators = isl_id_list_alloc(ctx, this->get_iterator_names().size());
-    if (this->get_iterator_names().size() > 0)
+    if ((schedule_tree != NULL) && (this->get_iterator_names().size() > 0))
+    {
+        // The schedule tree only has one band dimension per loop level.
+        for (const auto &name : this->get_iterator_names())
+        {
+            isl_id *id = isl_id_alloc(ctx, name.c_str(), NULL);
+            iterators = isl_id_list_add(iterators, id);
+        }
+
+        ast_build = isl_ast_build_set_iterators(ast_build, iterators);
+    }
+    else if (this->get_iterator_names().size() > 0)
     {
         std::string name = generate_new_variable_name();
         isl_id *id = isl_id_alloc(ctx, name.c_str(), NULL);
@@ -1216,11 +2471,22 @@ void function::gen_isl_ast()
                                 isl_union_map_to_str(umap)));
     DEBUG(3, tiramisu::str_dump("\n"));
 
-    this->ast = isl_ast_build_node_from_schedule_map(ast_build, umap);
+    if (schedule_tree != NULL)
+    {
+        isl_union_map_free(umap);
+        result = isl_ast_build_node_from_schedule(ast_build, schedule_tree);
+    }
+    else
+    {
+        ast_build = isl_ast_build_set_options(ast_build, this->get_ast_build_options(umap));
+        result = isl_ast_build_node_from_schedule_map(ast_build, umap);
+    }
 
     isl_ast_build_free(ast_build);
 
     DEBUG_INDENT(-4);
+
+    return result;
 }
 
 void tiramisu::function::allocate_and_map_buffers_automatically()
@@ -1368,6 +2634,18 @@ std::string tiramisu::function::get_gpu_block_iterator(const std::string &comp,
     return res;
 }
 
+bool tiramisu::function::should_stream(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &sd : this->stream_dimensions)
+        if ((std::get<0>(sd) == comp) && (std::get<1>(sd) == lev))
+            return true;
+
+    return false;
+}
+
 bool tiramisu::function::should_unroll(const std::string &comp, int lev0) const
 {
     assert(!comp.empty());
@@ -1577,7 +2855,7 @@ void tiramisu::function::add_computation(computation *cpt)
 
 void tiramisu::function::dump(bool exhaustive) const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         std::cout << "\n\nFunction \"" << this->name << "\"" << std::endl << std::endl;
 
@@ -1633,7 +2911,7 @@ void tiramisu::function::dump(bool exhaustive) const
 
 void tiramisu::function::dump_iteration_domain() const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         tiramisu::str_dump("\nIteration domain:\n");
         for (const auto &cpt : this->body)
@@ -1646,7 +2924,7 @@ void tiramisu::function::dump_iteration_domain() const
 
 void tiramisu::function::dump_schedule() const
 {
-    if (ENABLE_DEBUG)
+    if (DEBUG_ENABLED(3))
     {
         tiramisu::str_dump("\nDumping schedules of the function " + this->get_name() + " :\n");
 
@@ -1737,6 +3015,66 @@ void tiramisu::function::add_unroll_dimension(std::string stmt_name, int level,
     this->unroll_dimensions.push_back(std::make_tuple(stmt_name, level, factor));
 }
 
+void tiramisu::function::add_ast_loop_type(std::string stmt_name, int level, tiramisu::ast_loop_t type)
+{
+    assert(level >= 0);
+    assert(!stmt_name.empty());
+
+    this->ast_loop_types.push_back(std::make_tuple(stmt_name, level, type));
+}
+
+void tiramisu::function::add_stream_dimension(std::string stmt_name, int level,
+                                              const std::vector<tiramisu::buffer *> &buffers, int rows)
+{
+    assert(level >= 0);
+    assert(!stmt_name.empty());
+    assert(rows > 0);
+
+    this->stream_dimensions.push_back(std::make_tuple(stmt_name, level, buffers, rows));
+}
+
+isl_union_map *tiramisu::function::get_ast_build_options(isl_union_map *schedule) const
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    isl_union_map *options = isl_union_map_empty(isl_union_map_get_space(schedule));
+
+    for (const auto &lt : this->ast_loop_types)
+    {
+        if (std::get<2>(lt) == tiramisu::ast_loop_default)
+            continue;
+
+        // The options apply to the schedule dimension of the loop
+        // level, restricted to the instances of the computation.
+        // That dimension is the dynamic dimension of the level in the
+        // time-processor domain without its duplicate dimension.
+        int dim = loop_level_into_dynamic_dimension(std::get<1>(lt)) - 1;
+        std::string option = "{ " + ast_loop_type_option_name(std::get<2>(lt)) +
+                             "[" + std::to_string(dim) + "] }";
+
+        for (auto comp : this->get_computation_by_name(std::get<0>(lt)))
+        {
+            if (!comp->should_schedule_this_computation())
+                continue;
+
+            isl_union_set *domain = isl_union_set_apply(
+                isl_union_set_from_set(comp->get_trimmed_time_processor_domain()),
+                isl_union_map_copy(schedule));
+            isl_union_set *range = isl_union_set_from_set(
+                isl_set_read_from_str(this->get_isl_ctx(), option.c_str()));
+            options = isl_union_map_union(options,
+                                          isl_union_map_from_domain_and_range(domain, range));
+        }
+    }
+
+    DEBUG(3, tiramisu::str_dump("AST build options:", isl_union_map_to_str(options)));
+
+    DEBUG_INDENT(-4);
+
+    return options;
+}
+
 void tiramisu::function::add_gpu_block_dimensions(std::string stmt_name, int dim0,
         int dim1, int dim2)
 {
@@ -1916,9 +3254,28 @@ isl_union_map *tiramisu::function::get_trimmed_schedule() const
     return result;
 }
 
+void tiramisu::function::coalesce_communication()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    for (tiramisu::computation *comp : this->body)
+    {
+        if (comp->is_send())
+        {
+            tiramisu::send *s = static_cast<tiramisu::send *>(comp);
+            if (s->get_xfer_props().contains_attr(MPI) && s->get_matching_recv() != nullptr)
+                s->coalesce();
+        }
+    }
+
+    DEBUG_INDENT(-4);
+}
+
 void tiramisu::function::lift_dist_comps() {
     for (std::vector<tiramisu::computation *>::iterator comp = body.begin(); comp != body.end(); comp++) {
-        if ((*comp)->is_send() || (*comp)->is_recv() || (*comp)->is_wait() || (*comp)->is_send_recv()) {
+        if ((*comp)->is_send() || (*comp)->is_recv() || (*comp)->is_wait() || (*comp)->is_send_recv() ||
+            (*comp)->is_collective()) {
             xfer_prop chan = static_cast<tiramisu::communicator *>(*comp)->get_xfer_props();
             if (chan.contains_attr(MPI)) {
                 lift_mpi_comp(*comp);
@@ -1927,10 +3284,139 @@ void tiramisu::function::lift_dist_comps() {
             }
         }
     }
+    // Adds computations to the body: done once all the communications are lifted.
+    gen_rma_fences();
+}
+
+int tiramisu::function::get_rma_window_id(tiramisu::buffer *buf)
+{
+    auto window = std::find(this->rma_windows.begin(), this->rma_windows.end(), buf);
+    if (window != this->rma_windows.end())
+        return window - this->rma_windows.begin();
+    this->rma_windows.push_back(buf);
+    return this->rma_windows.size() - 1;
+}
+
+/**
+  * Return the buffer that the receive \p r writes.
+  */
+static tiramisu::buffer *get_recv_buffer(const tiramisu::function *fct, const tiramisu::recv *r)
+{
+    if (r->get_access_relation() == NULL)
+        ERROR("The receive " + r->get_name() + " does not have an access relation.", true);
+    const auto &buf = fct->get_buffers().find(isl_map_get_tuple_name(r->get_access_relation(), isl_dim_out));
+    assert(buf != fct->get_buffers().end() && "The buffer of the receive does not exist.");
+    return buf->second;
+}
+
+void tiramisu::function::gen_rma_fences()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    std::vector<tiramisu::send *> rma_sends;
+    for (auto comp : this->body)
+        if (comp->is_send() && static_cast<send *>(comp)->get_xfer_props().contains_attr(RMA))
+            rma_sends.push_back(static_cast<send *>(comp));
+
+    if (!rma_sends.empty() && this->use_low_level_scheduling_commands)
+        ERROR("The one-sided communications can only be ordered with after(), before() or then().", true);
+
+    for (auto s : rma_sends)
+    {
+        recv *r = s->get_matching_recv();
+        int window = this->get_rma_window_id(get_recv_buffer(this, r));
+
+        // The receive should follow the whole loop nest of the send: its data
+        // is only visible once the closing fence returns.
+        bool outside = false;
+        computation *c = r;
+        while (c != s && !this->sched_graph_reversed[c].empty())
+        {
+            auto pred = *(this->sched_graph_reversed[c].begin());
+            outside = outside || pred.second == computation::root_dimension;
+            c = pred.first;
+        }
+        if (c != s || !outside)
+            ERROR("The one-sided receive " + r->get_name() + " should be scheduled after " + s->get_name() +
+                  " at the root level.", true);
+        for (auto &succ : this->sched_graph[r])
+            if (succ.second != computation::root_dimension)
+                ERROR("The computation " + succ.first->get_name() + " should not be fused with the one-sided "
+                      "receive " + r->get_name() + ": the data is not received yet.", true);
+
+        // All the ranks execute the fences (they are not distributed), so the
+        // receivers do not need to know the senders or the number of messages.
+        computation *open = new computation("{_fence_open_" + s->get_name() + "[0]}", tiramisu::expr(),
+                                            true, p_none, this);
+        computation *close = new computation("{_fence_close_" + r->get_name() + "[0]}", tiramisu::expr(),
+                                             true, p_none, this);
+        for (auto fence : {open, close})
+        {
+            fence->_is_library_call = true;
+            fence->library_call_name = "tiramisu_MPI_Win_fence";
+            fence->library_call_args = {tiramisu::expr((int32_t) window)};
+        }
+
+        if (this->sched_graph_reversed[s].empty())
+            s->after(*open, computation::root_dimension);
+        else
+        {
+            auto pred = *(this->sched_graph_reversed[s].begin());
+            if (pred.second != computation::root_dimension)
+                ERROR("The one-sided send " + s->get_name() + " should not be fused with " +
+                      pred.first->get_name() + ".", true);
+            open->between(*pred.first, computation::root_dimension, *s, computation::root_dimension);
+        }
+
+        std::vector<computation *> successors;
+        for (auto &succ : this->sched_graph[r])
+            successors.push_back(succ.first);
+        close->after(*r, computation::root_dimension);
+        for (auto succ : successors)
+        {
+            this->sched_graph[r].erase(succ);
+            this->sched_graph_reversed[succ].erase(r);
+            succ->after(*close, computation::root_dimension);
+        }
+
+        DEBUG(3, tiramisu::str_dump("Fenced the one-sided exchange " + s->get_name() + " -> " + r->get_name()));
+    }
+
+    DEBUG_INDENT(-4);
 }
 
 void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
-    if (comp->is_send()) {
+    if (comp->is_send() && static_cast<send *>(comp)->get_xfer_props().contains_attr(RMA)) {
+        // One-sided send: (count, dest, window, data, displacement in the window)
+        send *s = static_cast<send *>(comp);
+        recv *r = s->get_matching_recv();
+        assert(r != nullptr && "A one-sided send needs a matching receive.");
+        tiramisu::buffer *target = get_recv_buffer(this, r);
+        s->rhs_argument_idx = 3;
+        s->rma_argument_idx = 4;
+        s->library_call_args.resize(5);
+        s->library_call_args[0] = tiramisu::expr(tiramisu::o_cast, p_int32, tiramisu::expr(s->get_num_elements()));
+        s->library_call_args[1] = tiramisu::expr(tiramisu::o_cast, p_int32, s->get_dest());
+        s->library_call_args[2] = tiramisu::expr((int32_t) this->get_rma_window_id(target));
+        // The send writes where the receive would have stored the data. The receive
+        // and the send have the same loop levels, so the access relation of the receive
+        // is evaluated at the iterations of the send (it should not use the rank of the
+        // receiver, which is not known by the sender).
+        isl_map *target_access = isl_map_copy(r->get_access_relation());
+        if (isl_map_dim(target_access, isl_dim_in) != isl_set_dim(s->get_iteration_domain(), isl_dim_set))
+            ERROR("The one-sided send " + s->get_name() + " and its receive " + r->get_name() +
+                  " should have the same number of dimensions.", true);
+        s->rma_access_map = isl_map_set_tuple_name(target_access, isl_dim_in, s->get_name().c_str());
+        // Reports an error if the send was collapsed with collapse_strided()
+        s->add_strided_library_call_args(5);
+    } else if (comp->is_recv() && static_cast<recv *>(comp)->get_xfer_props().contains_attr(RMA)) {
+        // One-sided receive: the data is written by the sender and made visible by the
+        // fences around the exchange (see gen_rma_fences()), so the receive is not executed.
+        recv *r = static_cast<recv *>(comp);
+        this->get_rma_window_id(get_recv_buffer(this, r));
+        r->unschedule_this_computation();
+    } else if (comp->is_send()) {
         send *s = static_cast<send *>(comp);
         tiramisu::expr num_elements(s->get_num_elements());
         tiramisu::expr send_type(s->get_xfer_props().get_dtype());
@@ -1945,6 +3431,8 @@ void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
             // This additional RHS argument is to the request buffer. It is really more of a side effect.
             s->wait_argument_idx = 4;
         }
+        // The counts and the strides of the strided loop levels (if any) come last
+        s->add_strided_library_call_args(isnonblock ? 5 : 4);
     } else if (comp->is_recv()) {
         recv *r = static_cast<recv *>(comp);
         send *s = r->get_matching_send();
@@ -1963,12 +3451,34 @@ void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
             // This RHS argument is to the request buffer. It is really more of a side effect.
           r->wait_argument_idx = 4;
         }
+        // The counts and the strides of the strided loop levels (if any) come last
+        r->add_strided_library_call_args(isnonblock ? 5 : 4);
     } else if (comp->is_wait()) {
         wait *w = static_cast<wait *>(comp);
         // Determine the appropriate number of function args and set ones that we can already know
         w->rhs_argument_idx = 0;
         w->library_call_args.resize(1);
         w->library_call_name = "tiramisu_MPI_Wait";
+    } else if (comp->is_collective()) {
+        collective *c = static_cast<collective *>(comp);
+        tiramisu::expr num_elements(c->get_num_elements());
+        bool isnonblock = c->get_xfer_props().contains_attr(NONBLOCK);
+        c->library_call_args.resize(isnonblock ? 4 : 3);
+        c->library_call_args[0] = tiramisu::expr(tiramisu::o_cast, p_int32, num_elements);
+        if (c->get_xfer_props().contains_attr(BCAST)) {
+            // Broadcast in place: (count, root, data)
+            c->library_call_args[1] = tiramisu::expr(tiramisu::o_cast, p_int32, c->get_root());
+            c->rhs_argument_idx = 2;
+        } else {
+            // (count, send data, receive data)
+            c->rhs_argument_idx = 1;
+            c->lhs_argument_idx = 2;
+            c->lhs_access_type = tiramisu::o_address_of;
+        }
+        if (isnonblock) {
+            // This additional argument is to the request buffer.
+            c->wait_argument_idx = 3;
+        }
     }
 }
 
@@ -2070,6 +3580,8 @@ void tiramisu::function::codegen(const std::vector<tiramisu::buffer *> &argument
             DEBUG(3, tiramisu::str_dump("You must specify the corresponding CPU buffer to each GPU buffer else you should do the communication manually"));
     }
     this->set_arguments(arguments);
+    this->distribute_buffers();
+    this->coalesce_communication();
     this->lift_dist_comps();
     this->gen_time_space_domain();
     this->gen_isl_ast();
@@ -2080,6 +3592,16 @@ void tiramisu::function::codegen(const std::vector<tiramisu::buffer *> &argument
     this->gen_halide_obj(obj_filename);
 }
 
+void tiramisu::function::codegen(const std::vector<tiramisu::buffer *> &arguments, const std::string obj_filename,
+                                 const std::vector<std::map<std::string, int>> &specializations,
+                                 const bool gen_cuda_stmt)
+{
+    for (const auto &values : specializations)
+        this->add_specialization(values);
+
+    this->codegen(arguments, obj_filename, gen_cuda_stmt);
+}
+
 const std::vector<std::string> tiramisu::function::get_invariant_names() const
 {
     const std::vector<tiramisu::constant> inv = this->get_invariants();
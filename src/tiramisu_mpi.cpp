@@ -1,20 +1,167 @@
+#include <algorithm>
 #include <cstdlib>
 #include <cstdio>
 #include <cassert>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
 #include "tiramisu/mpi_comm.h"
 
 #ifdef WITH_MPI
 
+/**
+  * Time (in seconds) spent by this rank inside MPI communication calls since the last
+  * call to tiramisu_MPI_reset_comm_time().  Atomic since the communications can be
+  * called by several threads (MPI_THREAD_MULTIPLE).
+  */
+static std::atomic<double> tiramisu_MPI_comm_time(0.0);
+
+static void tiramisu_MPI_add_comm_time(double time) {
+    double current = tiramisu_MPI_comm_time.load();
+    while (!tiramisu_MPI_comm_time.compare_exchange_weak(current, current + time));
+}
+
+#define timed_MPI_call(call) \
+{ \
+    double start = MPI_Wtime(); \
+    check_MPI_error(call); \
+    tiramisu_MPI_add_comm_time(MPI_Wtime() - start); \
+}
+
 int tiramisu_MPI_init() {
+    return tiramisu_MPI_init(MPI_THREAD_FUNNELED);
+}
+
+int tiramisu_MPI_init(int thread_level) {
     int provided = -1;
-    MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &provided);
-    assert(provided == MPI_THREAD_FUNNELED && "Did not get the appropriate MPI thread requirement.");
+    MPI_Init_thread(NULL, NULL, thread_level, &provided);
+    assert(provided >= thread_level && "Did not get the appropriate MPI thread requirement.");
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
     return rank;
 }
 
+/**
+  * The progress thread polls MPI so that the non-blocking communications
+  * progress while the other threads compute.  The thread sleeps after every
+  * poll, and the delay between two polls doubles (up to a maximum) until a
+  * new message arrives, so that an idle progress thread does not take a core
+  * from the worker threads.  A message that is not received yet is found
+  * again by every probe: it does not reset the delay.
+  */
+static std::thread *tiramisu_MPI_progress_thread = nullptr;
+static std::atomic<bool> tiramisu_MPI_progress_thread_running(false);
+
+#define TIRAMISU_MPI_PROGRESS_MIN_DELAY_US 1
+#define TIRAMISU_MPI_PROGRESS_MAX_DELAY_US 1000
+
+static void tiramisu_MPI_progress_loop() {
+    int delay = TIRAMISU_MPI_PROGRESS_MIN_DELAY_US;
+    int pending_source = MPI_ANY_SOURCE;
+    int pending_tag = MPI_ANY_TAG;
+    while (tiramisu_MPI_progress_thread_running.load()) {
+        int flag;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, &status);
+        if (flag && (status.MPI_SOURCE != pending_source || status.MPI_TAG != pending_tag)) {
+            delay = TIRAMISU_MPI_PROGRESS_MIN_DELAY_US;
+        }
+        pending_source = flag ? status.MPI_SOURCE : MPI_ANY_SOURCE;
+        pending_tag = flag ? status.MPI_TAG : MPI_ANY_TAG;
+        std::this_thread::sleep_for(std::chrono::microseconds(delay));
+        delay = std::min(2 * delay, TIRAMISU_MPI_PROGRESS_MAX_DELAY_US);
+    }
+}
+
+int tiramisu_MPI_init_hybrid() {
+    int rank = tiramisu_MPI_init(MPI_THREAD_MULTIPLE);
+    tiramisu_MPI_start_progress_thread();
+    return rank;
+}
+
+void tiramisu_MPI_start_progress_thread() {
+    int provided;
+    MPI_Query_thread(&provided);
+    assert(provided == MPI_THREAD_MULTIPLE && "The progress thread requires MPI_THREAD_MULTIPLE.");
+    if (tiramisu_MPI_progress_thread == nullptr) {
+        tiramisu_MPI_progress_thread_running.store(true);
+        tiramisu_MPI_progress_thread = new std::thread(tiramisu_MPI_progress_loop);
+    }
+}
+
+void tiramisu_MPI_stop_progress_thread() {
+    if (tiramisu_MPI_progress_thread != nullptr) {
+        tiramisu_MPI_progress_thread_running.store(false);
+        tiramisu_MPI_progress_thread->join();
+        delete tiramisu_MPI_progress_thread;
+        tiramisu_MPI_progress_thread = nullptr;
+    }
+}
+
+/**
+  * Persistent requests, created the first time a communication is executed and
+  * restarted the next times.  A communication is identified by its kind, its
+  * buffer, its number of elements, its peer, its tag and its datatype.
+  */
+typedef std::tuple<int, void*, int, int, int, MPI_Datatype> persistent_key;
+static std::map<persistent_key, MPI_Request*> tiramisu_MPI_persistent_requests;
+static std::mutex tiramisu_MPI_persistent_requests_mutex;
+
+enum persistent_kind { persistent_send, persistent_ssend, persistent_recv };
+
+static MPI_Request *tiramisu_MPI_get_persistent_request(persistent_kind kind, void *data, int count, int peer,
+                                                        int tag, MPI_Datatype type)
+{
+    std::lock_guard<std::mutex> lock(tiramisu_MPI_persistent_requests_mutex);
+    persistent_key key(kind, data, count, peer, tag, type);
+    auto request = tiramisu_MPI_persistent_requests.find(key);
+    if (request != tiramisu_MPI_persistent_requests.end())
+        return request->second;
+    MPI_Request *new_request = (MPI_Request*)malloc(sizeof(MPI_Request));
+    if (kind == persistent_send) {
+        check_MPI_error(MPI_Send_init(data, count, type, peer, tag, MPI_COMM_WORLD, new_request));
+    } else if (kind == persistent_ssend) {
+        check_MPI_error(MPI_Ssend_init(data, count, type, peer, tag, MPI_COMM_WORLD, new_request));
+    } else {
+        check_MPI_error(MPI_Recv_init(data, count, type, peer, tag, MPI_COMM_WORLD, new_request));
+    }
+    tiramisu_MPI_persistent_requests[key] = new_request;
+    return new_request;
+}
+
+static void tiramisu_MPI_free_persistent_requests()
+{
+    std::lock_guard<std::mutex> lock(tiramisu_MPI_persistent_requests_mutex);
+    for (auto &request : tiramisu_MPI_persistent_requests) {
+        check_MPI_error(MPI_Request_free(request.second));
+        free(request.second);
+    }
+    tiramisu_MPI_persistent_requests.clear();
+}
+
+/**
+  * The windows that expose the buffers written by the one-sided communications,
+  * indexed by their id, with the base and the size (in bytes) that they expose.
+  * They are created by the first call to tiramisu_MPI_Win_create() and freed by
+  * tiramisu_MPI_cleanup().
+  */
+static std::map<int, std::tuple<MPI_Win, void *, long>> tiramisu_MPI_windows;
+
+static void tiramisu_MPI_free_windows()
+{
+    for (auto &window : tiramisu_MPI_windows) {
+        check_MPI_error(MPI_Win_free(&std::get<0>(window.second)));
+    }
+    tiramisu_MPI_windows.clear();
+}
+
 void tiramisu_MPI_cleanup() {
+    tiramisu_MPI_stop_progress_thread();
+    tiramisu_MPI_free_persistent_requests();
+    tiramisu_MPI_free_windows();
     MPI_Finalize();
 }
 
@@ -22,32 +169,61 @@ void tiramisu_MPI_global_barrier() {
     MPI_Barrier(MPI_COMM_WORLD);
 }
 
+void tiramisu_MPI_reset_comm_time() {
+    tiramisu_MPI_comm_time.store(0.0);
+}
+
+double tiramisu_MPI_get_comm_time() {
+    return tiramisu_MPI_comm_time.load() * 1000.0;
+}
+
+void tiramisu_MPI_print_rank_times(const char *kernel_name, double total_time, double comm_time) {
+    int rank, nb_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nb_ranks);
+    double times[2] = {total_time, comm_time};
+    double *all_times = NULL;
+    if (rank == 0) {
+        all_times = (double*)malloc(2 * nb_ranks * sizeof(double));
+    }
+    MPI_Gather(times, 2, MPI_DOUBLE, all_times, 2, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    if (rank == 0) {
+        printf("%s on %d ranks (ms)\n", kernel_name, nb_ranks);
+        printf("rank; total; compute; communication\n");
+        for (int r = 0; r < nb_ranks; r++) {
+            double total = all_times[2 * r], comm = all_times[2 * r + 1];
+            printf("%d; %f; %f; %f\n", r, total, total - comm, comm);
+        }
+        free(all_times);
+    }
+}
+
 extern "C" {
 
 #define make_Send(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Send_##suffix(int count, int dest, int tag, c_datatype *data) \
 { \
-    check_MPI_error(MPI_Send(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD)); \
+    timed_MPI_call(MPI_Send(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD)); \
 }
 
 #define make_Ssend(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Ssend_##suffix(int count, int dest, int tag, c_datatype *data) \
 { \
-    check_MPI_error(MPI_Ssend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD)); \
+    timed_MPI_call(MPI_Ssend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD)); \
 }
 
 #define make_Isend(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Isend_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs) \
 { \
     ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
-    check_MPI_error(MPI_Isend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
+    timed_MPI_call(MPI_Isend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
 }
 
 #define make_Issend(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Issend_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs) \
 { \
     ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
-    check_MPI_error(MPI_Issend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
+    timed_MPI_call(MPI_Issend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
 }
 
 #define make_Recv(suffix, c_datatype, mpi_datatype) \
@@ -55,7 +231,7 @@ void tiramisu_MPI_Recv_##suffix(int count, int source, int tag, \
                                 c_datatype *store_in) \
 { \
     MPI_Status status; \
-    check_MPI_error(MPI_Recv(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, &status)); \
+    timed_MPI_call(MPI_Recv(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, &status)); \
 }
 
 #define make_Irecv(suffix, c_datatype, mpi_datatype) \
@@ -63,10 +239,168 @@ void tiramisu_MPI_Irecv_##suffix(int count, int source, int tag, \
                                  c_datatype *store_in, long *reqs) \
 { \
     ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
-    check_MPI_error(MPI_Irecv(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, \
+    timed_MPI_call(MPI_Irecv(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, \
                               ((MPI_Request**)reqs)[0])); \
 }
 
+#define make_Psend(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Psend_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = tiramisu_MPI_get_persistent_request(persistent_send, data, count, dest, tag, \
+                                                                   mpi_datatype); \
+    timed_MPI_call(MPI_Start(((MPI_Request**)reqs)[0])); \
+}
+
+#define make_Pssend(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Pssend_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = tiramisu_MPI_get_persistent_request(persistent_ssend, data, count, dest, tag, \
+                                                                   mpi_datatype); \
+    timed_MPI_call(MPI_Start(((MPI_Request**)reqs)[0])); \
+}
+
+#define make_Precv(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Precv_##suffix(int count, int source, int tag, c_datatype *store_in, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = tiramisu_MPI_get_persistent_request(persistent_recv, store_in, count, source, tag, \
+                                                                   mpi_datatype); \
+    timed_MPI_call(MPI_Start(((MPI_Request**)reqs)[0])); \
+}
+
+#define make_Put(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Put_##suffix(int count, int dest, int window, c_datatype *data, long displacement) \
+{ \
+    MPI_Win win = std::get<0>(tiramisu_MPI_windows.at(window)); \
+    timed_MPI_call(MPI_Put(data, count, mpi_datatype, dest, (MPI_Aint) displacement, count, mpi_datatype, win)); \
+}
+
+#define make_Allreduce(op_suffix, mpi_op, suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Allreduce_##op_suffix##_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    timed_MPI_call(MPI_Allreduce(data, store_in, count, mpi_datatype, mpi_op, MPI_COMM_WORLD)); \
+}
+
+#define make_Iallreduce(op_suffix, mpi_op, suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Iallreduce_##op_suffix##_##suffix(int count, c_datatype *data, c_datatype *store_in, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Iallreduce(data, store_in, count, mpi_datatype, mpi_op, MPI_COMM_WORLD, \
+                                   ((MPI_Request**)reqs)[0])); \
+}
+
+#define make_Allgather(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Allgather_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    timed_MPI_call(MPI_Allgather(data, count, mpi_datatype, store_in, count, mpi_datatype, MPI_COMM_WORLD)); \
+}
+
+#define make_Iallgather(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Iallgather_##suffix(int count, c_datatype *data, c_datatype *store_in, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Iallgather(data, count, mpi_datatype, store_in, count, mpi_datatype, MPI_COMM_WORLD, \
+                                   ((MPI_Request**)reqs)[0])); \
+}
+
+#define make_Bcast(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Bcast_##suffix(int count, int root, c_datatype *data) \
+{ \
+    timed_MPI_call(MPI_Bcast(data, count, mpi_datatype, root, MPI_COMM_WORLD)); \
+}
+
+#define make_Ibcast(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Ibcast_##suffix(int count, int root, c_datatype *data, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Ibcast(data, count, mpi_datatype, root, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
+}
+
+#define make_Alltoall(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Alltoall_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    timed_MPI_call(MPI_Alltoall(data, count, mpi_datatype, store_in, count, mpi_datatype, MPI_COMM_WORLD)); \
+}
+
+#define make_Ialltoall(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Ialltoall_##suffix(int count, c_datatype *data, c_datatype *store_in, long *reqs) \
+{ \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Ialltoall(data, count, mpi_datatype, store_in, count, mpi_datatype, MPI_COMM_WORLD, \
+                                  ((MPI_Request**)reqs)[0])); \
+}
+
+// Strided variants: each of the count0 (resp. count1) blocks of count contiguous elements
+// is stride0 (resp. stride1) elements after the previous one.
+#define strided_params int count0, int stride0, int count1, int stride1
+
+#define make_Send_strided(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Send_strided_##suffix(int count, int dest, int tag, c_datatype *data, strided_params) \
+{ \
+    MPI_Datatype type = tiramisu_MPI_create_strided_type(count, count0, stride0, count1, stride1, mpi_datatype, sizeof(c_datatype)); \
+    timed_MPI_call(MPI_Send(data, 1, type, dest, tag, MPI_COMM_WORLD)); \
+    check_MPI_error(MPI_Type_free(&type)); \
+}
+
+#define make_Ssend_strided(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Ssend_strided_##suffix(int count, int dest, int tag, c_datatype *data, strided_params) \
+{ \
+    MPI_Datatype type = tiramisu_MPI_create_strided_type(count, count0, stride0, count1, stride1, mpi_datatype, sizeof(c_datatype)); \
+    timed_MPI_call(MPI_Ssend(data, 1, type, dest, tag, MPI_COMM_WORLD)); \
+    check_MPI_error(MPI_Type_free(&type)); \
+}
+
+#define make_Isend_strided(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Isend_strided_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs, \
+                                         strided_params) \
+{ \
+    MPI_Datatype type = tiramisu_MPI_create_strided_type(count, count0, stride0, count1, stride1, mpi_datatype, sizeof(c_datatype)); \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Isend(data, 1, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
+    check_MPI_error(MPI_Type_free(&type)); \
+}
+
+#define make_Issend_strided(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Issend_strided_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs, \
+                                          strided_params) \
+{ \
+    MPI_Datatype type = tiramisu_MPI_create_strided_type(count, count0, stride0, count1, stride1, mpi_datatype, sizeof(c_datatype)); \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Issend(data, 1, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
+    check_MPI_error(MPI_Type_free(&type)); \
+}
+
+#define make_Recv_strided(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Recv_strided_##suffix(int count, int source, int tag, c_datatype *store_in, strided_params) \
+{ \
+    MPI_Status status; \
+    MPI_Datatype type = tiramisu_MPI_create_strided_type(count, count0, stride0, count1, stride1, mpi_datatype, sizeof(c_datatype)); \
+    timed_MPI_call(MPI_Recv(store_in, 1, type, source, tag, MPI_COMM_WORLD, &status)); \
+    check_MPI_error(MPI_Type_free(&type)); \
+}
+
+#define make_Irecv_strided(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Irecv_strided_##suffix(int count, int source, int tag, c_datatype *store_in, long *reqs, \
+                                         strided_params) \
+{ \
+    MPI_Datatype type = tiramisu_MPI_create_strided_type(count, count0, stride0, count1, stride1, mpi_datatype, sizeof(c_datatype)); \
+    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    timed_MPI_call(MPI_Irecv(store_in, 1, type, source, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
+    check_MPI_error(MPI_Type_free(&type)); \
+}
+
+// Instantiate make_fct(args..., suffix, c_datatype, mpi_datatype) for all the supported types.
+#define make_for_all_types(make_fct, ...) \
+make_fct(__VA_ARGS__ int8, char, MPI_SIGNED_CHAR) \
+make_fct(__VA_ARGS__ uint8, unsigned char, MPI_UNSIGNED_CHAR) \
+make_fct(__VA_ARGS__ int16, short, MPI_SHORT) \
+make_fct(__VA_ARGS__ uint16, unsigned short, MPI_UNSIGNED_SHORT) \
+make_fct(__VA_ARGS__ int32, int, MPI_INT) \
+make_fct(__VA_ARGS__ uint32, unsigned int, MPI_UNSIGNED) \
+make_fct(__VA_ARGS__ int64, long, MPI_LONG) \
+make_fct(__VA_ARGS__ uint64, unsigned long, MPI_UNSIGNED_LONG) \
+make_fct(__VA_ARGS__ f32, float, MPI_FLOAT) \
+make_fct(__VA_ARGS__ f64, double, MPI_DOUBLE)
+
 inline void check_MPI_error(int ret_val) 
 {
     if (ret_val != MPI_SUCCESS) {
@@ -75,6 +409,35 @@ inline void check_MPI_error(int ret_val)
     }
 }
 
+/**
+  * Create (and commit) a datatype made of count1 blocks separated by stride1 elements, each
+  * made of count0 blocks separated by stride0 elements, each made of count contiguous elements.
+  * The datatype can be freed as soon as the communication that uses it is started.
+  */
+MPI_Datatype tiramisu_MPI_create_strided_type(int count, int count0, int stride0, int count1, int stride1,
+                                 MPI_Datatype element_type, int element_size)
+{
+    MPI_Datatype block, inner, strided;
+    check_MPI_error(MPI_Type_contiguous(count, element_type, &block));
+    check_MPI_error(MPI_Type_create_hvector(count0, 1, (MPI_Aint) stride0 * element_size, block, &inner));
+    check_MPI_error(MPI_Type_create_hvector(count1, 1, (MPI_Aint) stride1 * element_size, inner, &strided));
+    check_MPI_error(MPI_Type_commit(&strided));
+    check_MPI_error(MPI_Type_free(&block));
+    check_MPI_error(MPI_Type_free(&inner));
+    return strided;
+}
+
+void tiramisu_MPI_check_thread_multiple()
+{
+    int provided;
+    check_MPI_error(MPI_Query_thread(&provided));
+    if (provided != MPI_THREAD_MULTIPLE) {
+        fprintf(stderr, "This function communicates from parallel loops: initialize MPI with "
+                        "tiramisu_MPI_init_hybrid() or tiramisu_MPI_init(MPI_THREAD_MULTIPLE).\n");
+        exit(28);
+    }
+}
+
 int tiramisu_MPI_Comm_rank(int offset) 
 {
     int rank;
@@ -82,15 +445,37 @@ int tiramisu_MPI_Comm_rank(int offset)
     return rank + offset;
 }
 
+void tiramisu_MPI_Win_create(int window, void *base, long size, int element_size)
+{
+    const auto &existing = tiramisu_MPI_windows.find(window);
+    if (existing != tiramisu_MPI_windows.end()) {
+        // The window was created by a previous call of the function
+        if (std::get<1>(existing->second) != base || std::get<2>(existing->second) != size) {
+            fprintf(stderr, "The buffers written by one-sided communications should not change between "
+                            "the calls of a function (window %d).\n", window);
+            exit(28);
+        }
+        return;
+    }
+    MPI_Win win;
+    check_MPI_error(MPI_Win_create(base, (MPI_Aint) size, element_size, MPI_INFO_NULL, MPI_COMM_WORLD, &win));
+    tiramisu_MPI_windows[window] = std::make_tuple(win, base, size);
+}
+
+void tiramisu_MPI_Win_fence(int window)
+{
+    timed_MPI_call(MPI_Win_fence(0, std::get<0>(tiramisu_MPI_windows.at(window))));
+}
+
 void tiramisu_MPI_Wait(void *request) 
 {
     MPI_Status status;
-    check_MPI_error(MPI_Wait((MPI_Request*)request, &status));
+    timed_MPI_call(MPI_Wait((MPI_Request*)request, &status));
 }
 
 void tiramisu_MPI_Send(int count, int dest, int tag, char *data, MPI_Datatype type) 
 {
-    check_MPI_error(MPI_Send(data, count, type, dest, tag, MPI_COMM_WORLD));
+    timed_MPI_call(MPI_Send(data, count, type, dest, tag, MPI_COMM_WORLD));
 }
 
 make_Send(int8, char, MPI_SIGNED_CHAR)
@@ -106,7 +491,7 @@ make_Send(f64, double, MPI_DOUBLE)
 
 void tiramisu_MPI_Ssend(int count, int dest, int tag, char *data, MPI_Datatype type) 
 {
-    check_MPI_error(MPI_Ssend(data, count, type, dest, tag, MPI_COMM_WORLD));
+    timed_MPI_call(MPI_Ssend(data, count, type, dest, tag, MPI_COMM_WORLD));
 }
 
 make_Ssend(int8, char, MPI_SIGNED_CHAR)
@@ -123,7 +508,7 @@ make_Ssend(f64, double, MPI_DOUBLE)
 void tiramisu_MPI_Isend(int count, int dest, int tag, char *data, MPI_Datatype type, long *reqs) 
 {
     ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request));
-    check_MPI_error(MPI_Isend(data, count, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0]));
+    timed_MPI_call(MPI_Isend(data, count, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0]));
 }
 
 make_Isend(int8, char, MPI_SIGNED_CHAR)
@@ -140,7 +525,7 @@ make_Isend(f64, double, MPI_DOUBLE)
 void tiramisu_MPI_Issend(int count, int dest, int tag, char *data, MPI_Datatype type, long *reqs) 
 {
     ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request));
-    check_MPI_error(MPI_Issend(data, count, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0]));
+    timed_MPI_call(MPI_Issend(data, count, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0]));
 }
 
 make_Issend(int8, char, MPI_SIGNED_CHAR)
@@ -158,7 +543,7 @@ void tiramisu_MPI_Recv(int count, int source, int tag,
                      char *store_in, MPI_Datatype type) 
 {
     MPI_Status status;
-    check_MPI_error(MPI_Recv(store_in, count, type, source, tag, MPI_COMM_WORLD, &status));
+    timed_MPI_call(MPI_Recv(store_in, count, type, source, tag, MPI_COMM_WORLD, &status));
 }
 
 make_Recv(int8, char, MPI_SIGNED_CHAR)
@@ -176,7 +561,7 @@ void tiramisu_MPI_Irecv(int count, int source, int tag,
                       char *store_in, MPI_Datatype type, long *reqs) 
 {
     ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request));
-    check_MPI_error(MPI_Irecv(store_in, count, type, source, tag, MPI_COMM_WORLD,
+    timed_MPI_call(MPI_Irecv(store_in, count, type, source, tag, MPI_COMM_WORLD,
                               ((MPI_Request**)reqs)[0]));
 }
 
@@ -191,6 +576,35 @@ make_Irecv(uint64, unsigned long, MPI_UNSIGNED_LONG)
 make_Irecv(f32, float, MPI_FLOAT)
 make_Irecv(f64, double, MPI_DOUBLE)
 
+make_for_all_types(make_Allreduce, sum, MPI_SUM,)
+make_for_all_types(make_Allreduce, prod, MPI_PROD,)
+make_for_all_types(make_Allreduce, max, MPI_MAX,)
+make_for_all_types(make_Allreduce, min, MPI_MIN,)
+make_for_all_types(make_Iallreduce, sum, MPI_SUM,)
+make_for_all_types(make_Iallreduce, prod, MPI_PROD,)
+make_for_all_types(make_Iallreduce, max, MPI_MAX,)
+make_for_all_types(make_Iallreduce, min, MPI_MIN,)
+
+make_for_all_types(make_Psend,)
+make_for_all_types(make_Pssend,)
+make_for_all_types(make_Precv,)
+
+make_for_all_types(make_Put,)
+
+make_for_all_types(make_Send_strided,)
+make_for_all_types(make_Ssend_strided,)
+make_for_all_types(make_Isend_strided,)
+make_for_all_types(make_Issend_strided,)
+make_for_all_types(make_Recv_strided,)
+make_for_all_types(make_Irecv_strided,)
+
+make_for_all_types(make_Allgather,)
+make_for_all_types(make_Iallgather,)
+make_for_all_types(make_Bcast,)
+make_for_all_types(make_Ibcast,)
+make_for_all_types(make_Alltoall,)
+make_for_all_types(make_Ialltoall,)
+
 }
 
 #endif
@@ -3,6 +3,12 @@
 #include <stdexcept>
 #include <iomanip>
 #include <fstream>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using std::string;
 using std::vector;
@@ -93,4 +99,150 @@ void combine_dist_results(const std::string &test, std::vector<int> dims, int nu
     }
     output_file.flush();
     output_file.close();
-}
\ No newline at end of file
+}
+
+namespace
+{
+const char buffer_file_magic[8] = {'T', 'I', 'R', 'A', 'B', 'U', 'F', '1'};
+
+// Alignment of the data in a buffer file.  It is a multiple of the page
+// size on all the targets we support.
+const uint64_t buffer_file_alignment = 4096;
+
+struct buffer_file_header
+{
+    char magic[8];
+    uint8_t type_code;
+    uint8_t type_bits;
+    uint16_t type_lanes;
+    uint32_t dimensions;
+    uint64_t data_offset;
+    uint64_t data_size;
+    // Followed by one int32_t extent per dimension.
+};
+}
+
+void save_buffer_file(const std::string &file_name, halide_type_t type,
+                      const std::vector<int> &sizes, const void *data,
+                      size_t size_bytes)
+{
+    buffer_file_header header;
+    std::memcpy(header.magic, buffer_file_magic, sizeof(header.magic));
+    header.type_code = type.code;
+    header.type_bits = type.bits;
+    header.type_lanes = type.lanes;
+    header.dimensions = sizes.size();
+    uint64_t header_size = sizeof(header) + sizes.size() * sizeof(int32_t);
+    header.data_offset = (header_size + buffer_file_alignment - 1) / buffer_file_alignment
+                         * buffer_file_alignment;
+    header.data_size = size_bytes;
+
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        ERROR("Cannot open the buffer file " + file_name + ".", true);
+
+    file.write((const char *) &header, sizeof(header));
+    for (int size : sizes)
+    {
+        int32_t extent = size;
+        file.write((const char *) &extent, sizeof(extent));
+    }
+    std::vector<char> padding(header.data_offset - header_size, 0);
+    file.write(padding.data(), padding.size());
+    file.write((const char *) data, size_bytes);
+
+    if (!file.good())
+        ERROR("Cannot write the buffer file " + file_name + ".", true);
+}
+
+void *map_buffer_file(const std::string &file_name, halide_type_t type,
+                      buffer_file_access_t access, bool huge_pages,
+                      void **data, std::vector<int> &sizes,
+                      size_t &mapping_size)
+{
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+        ERROR("Cannot open the buffer file " + file_name + ".", true);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(buffer_file_header))
+        ERROR("The buffer file " + file_name + " is too small.", true);
+    mapping_size = st.st_size;
+
+    // A private writable mapping: the generated code takes non-const
+    // buffers, and writes must not reach the file.
+    void *mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+        ERROR("Cannot map the buffer file " + file_name + ".", true);
+
+    const buffer_file_header *header = (const buffer_file_header *) mapping;
+    if (std::memcmp(header->magic, buffer_file_magic, sizeof(header->magic)) != 0)
+        ERROR(file_name + " is not a buffer file.", true);
+    if (header->type_code != type.code || header->type_bits != type.bits ||
+        header->type_lanes != type.lanes)
+        ERROR("The type of the elements of the buffer file " + file_name +
+              " does not match the type of the buffer.", true);
+
+    // The extents should be in the file before they are read.
+    if (header->dimensions > (mapping_size - sizeof(buffer_file_header)) / sizeof(int32_t))
+        ERROR("The buffer file " + file_name + " is truncated.", true);
+    uint64_t header_size = sizeof(buffer_file_header) + header->dimensions * sizeof(int32_t);
+    // Written so that data_offset + data_size cannot overflow.
+    if (header_size > header->data_offset || header->data_offset > mapping_size ||
+        header->data_size > mapping_size - header->data_offset)
+        ERROR("The buffer file " + file_name + " is truncated.", true);
+
+    const int32_t *extents = (const int32_t *) (header + 1);
+    sizes.clear();
+    bool empty = false;
+    for (uint32_t i = 0; i < header->dimensions; i++)
+    {
+        if (extents[i] < 0)
+            ERROR("The buffer file " + file_name + " has a negative extent.", true);
+        sizes.push_back(extents[i]);
+        empty = empty || (extents[i] == 0);
+    }
+    // The number of elements is bounded by the number of elements in the data,
+    // so that nb_elements * type.bytes() cannot overflow.
+    uint64_t max_elements = header->data_size / type.bytes();
+    uint64_t nb_elements = 1;
+    for (uint32_t i = 0; !empty && i < header->dimensions; i++)
+    {
+        if (nb_elements > max_elements / extents[i])
+            ERROR("The buffer file " + file_name + " is truncated.", true);
+        nb_elements *= extents[i];
+    }
+
+    *data = (char *) mapping + header->data_offset;
+
+    int advice = MADV_NORMAL;
+    switch (access)
+    {
+    case buffer_file_sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+    case buffer_file_random:
+        advice = MADV_RANDOM;
+        break;
+    case buffer_file_willneed:
+        advice = MADV_WILLNEED;
+        break;
+    default:
+        break;
+    }
+    // The hints are only advisory, failures are ignored.
+    madvise(mapping, mapping_size, advice);
+#ifdef MADV_HUGEPAGE
+    if (huge_pages)
+        madvise(mapping, mapping_size, MADV_HUGEPAGE);
+#endif
+
+    return mapping;
+}
+
+void unmap_buffer_file(void *mapping, size_t mapping_size)
+{
+    munmap(mapping, mapping_size);
+}
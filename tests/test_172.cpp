@@ -0,0 +1,66 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_172.h"
+
+using namespace tiramisu;
+
+/**
+ * Test automatic fusion.
+ *
+ * The consumer reads B(i+1, j), so it can only be fused with the producer
+ * at the innermost loop level if it is shifted by one iteration.
+ */
+
+void generate_function(std::string name, int size, int val0)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N), i0("i", 0, N-1);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B({i, j}, A(i, j) + tiramisu::expr((uint8_t) val0));
+    tiramisu::computation C({i0, j}, B(i0, j) + B(i0 + 1, j));
+
+    // Schedule
+    global::get_implicit_function()->fuse_automatically();
+
+    // C is fused with B at the loop level j and shifted by one iteration
+    // along i: C(i, j) runs in the same iteration as B(i + 1, j), after it.
+    assert(C.get_predecessor() == &B && "C should be scheduled after B.");
+
+    isl_ctx *ctx = isl_map_get_ctx(C.get_schedule());
+    isl_set *B_time = isl_set_apply(isl_set_read_from_str(ctx, ("{" + B.get_name() + "[1,0]}").c_str()),
+                                    isl_map_copy(B.get_schedule()));
+    isl_set *C_time = isl_set_apply(isl_set_read_from_str(ctx, ("{" + C.get_name() + "[0,0]}").c_str()),
+                                    isl_map_copy(C.get_schedule()));
+    for (int level = 0; level <= 1; level++)
+    {
+        int dim = loop_level_into_dynamic_dimension(level);
+        isl_val *B_it = isl_set_plain_get_val_if_fixed(B_time, isl_dim_set, dim);
+        isl_val *C_it = isl_set_plain_get_val_if_fixed(C_time, isl_dim_set, dim);
+        assert(isl_val_eq(B_it, C_it) == isl_bool_true && "C should be fused with B at the loop levels i and j.");
+        isl_val_free(B_it);
+        isl_val_free(C_it);
+    }
+    isl_set_free(B_time);
+    isl_set_free(C_time);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_temporary);
+    tiramisu::buffer buff_C("buff_C", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_C}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1, 3);
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_173.h"
+
+using namespace tiramisu;
+
+/**
+ * Test overlapped tiling.
+ */
+
+void generate_function(std::string name, int size, int val0)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::var i0("i", 0, N-2), j0("j", 0, N-2);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation bx({i, j0}, A(i, j0) + A(i, j0 + 1) + A(i, j0 + 2));
+    tiramisu::computation by({i0, j0}, bx(i0, j0) + bx(i0 + 1, j0) + bx(i0 + 2, j0));
+
+    // Schedule: bx is stored in a scratch buffer allocated in each tile.
+    global::get_implicit_function()->overlapped_tile({&bx, &by}, {4, 4});
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_by("buff_by", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    by.store_in(&buff_by);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_by}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1, 0);
+
+    return 0;
+}
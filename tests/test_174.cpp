@@ -0,0 +1,37 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_174.h"
+
+using namespace tiramisu;
+
+/**
+ * Test diamond tiling on a time-iterated 1D stencil.
+ */
+
+void generate_function(std::string name, int size, int val0)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var t("t", 1, N), i("i", 1, N-1);
+
+    tiramisu::computation A({t, i}, p_uint8);
+    A.set_expression(A(t-1, i-1) + A(t-1, i) + A(t-1, i+1));
+
+    // Schedule
+    A.diamond_tile(t, i, 4);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+
+    // Code generation
+    tiramisu::codegen({&buff_A}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1, 0);
+
+    return 0;
+}
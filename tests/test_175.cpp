@@ -0,0 +1,37 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_175.h"
+
+using namespace tiramisu;
+
+/**
+ * Test wavefront parallelization.
+ */
+
+void generate_function(std::string name, int size, int val0)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 1, N), j("j", 1, N);
+
+    tiramisu::computation A({i, j}, p_uint8);
+    A.set_expression(A(i-1, j) + A(i, j-1));
+
+    // Schedule
+    A.wavefront(i, j);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+
+    // Code generation
+    tiramisu::codegen({&buff_A}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1, 0);
+
+    return 0;
+}
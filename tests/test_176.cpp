@@ -0,0 +1,45 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_176.h"
+
+using namespace tiramisu;
+
+/**
+ * Test software prefetching.
+ */
+
+void generate_function(std::string name, int size, int val0)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::input A("A", {i, j}, p_uint8);
+    tiramisu::input B("B", {i, j}, p_uint8);
+
+    tiramisu::computation C({i, j}, A(j, i) + B(i, j));
+
+    // Schedule
+    // A is accessed with a stride (transposed), so it is prefetched
+    // automatically. B is prefetched one row ahead.
+    C.prefetch_automatically(4);
+    C.prefetch(B, i, 1);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_C("buff_C", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B, &buff_C}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1, 0);
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_178.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Test collective communications (allreduce and broadcast).
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function collectives(name);
+
+    computation local("{local[i]: 0<=i<" + std::to_string(_N) + "}", expr(), false, p_float64, &collectives);
+    computation shared("{shared[i]: 0<=i<" + std::to_string(_N) + "}", expr(), false, p_float64, &collectives);
+
+    // Sum the local vectors of all the ranks.
+    collective sum("{sum[0]}", local(0), xfer_prop(p_float64, {MPI, BLOCK, ALLREDUCE}), {_N}, &collectives);
+
+    // Broadcast the shared vector of the rank 0.
+    collective bcast("{bcast[0]}", shared(0), xfer_prop(p_float64, {MPI, BLOCK, BCAST}), {_N}, &collectives,
+                     o_add, 0);
+
+    sum.then(bcast, computation::root);
+
+    buffer b_local("b_local", {_N}, p_float64, a_input, &collectives);
+    buffer b_shared("b_shared", {_N}, p_float64, a_output, &collectives);
+    buffer b_sum("b_sum", {_N}, p_float64, a_output, &collectives);
+
+    local.set_access("{local[i]->b_local[i]}");
+    shared.set_access("{shared[i]->b_shared[i]}");
+    sum.set_access("{sum[i]->b_sum[i]}");
+
+    collectives.codegen({&b_local, &b_shared, &b_sum}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("collectives");
+    return 0;
+}
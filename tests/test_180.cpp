@@ -0,0 +1,51 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_180.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Send the first column of a row-major buffer in one message (using a
+ * strided MPI datatype) and store it in the last column of the buffer
+ * of the receiver.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function strided(name);
+
+    var i("i"), j("j"), q("q");
+
+    computation input("{input[i,j]: 0<=i<" + std::to_string(_N) + " and 0<=j<" + std::to_string(_M) + "}",
+                      expr(), false, p_int32, &strided);
+
+    xfer column = computation::create_xfer("{send[q,i]: 0<=q<1 and 0<=i<" + std::to_string(_N) + "}",
+                                           "{recv[q,i]: 1<=q<2 and 0<=i<" + std::to_string(_N) + "}",
+                                           q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                           xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), input(i, 0), &strided);
+
+    column.s->tag_distribute_level(q);
+    column.r->tag_distribute_level(q);
+
+    column.s->before(*column.r, computation::root);
+
+    buffer buff("buff", {_N, _M}, p_int32, a_output, &strided);
+
+    input.set_access("{input[i,j]->buff[i,j]}");
+    column.r->set_access("{recv[q,i]->buff[i," + std::to_string(_M - 1) + "]}");
+
+    // The stride (_M) is derived from the access relations.
+    column.s->collapse_strided(1, 0, _N);
+    column.r->collapse_strided(1, 0, _N);
+
+    strided.codegen({&buff}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("strided_column");
+    return 0;
+}
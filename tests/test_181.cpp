@@ -0,0 +1,59 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_181.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Same as test_160 but the data distribution is described on the buffers
+ * (owner-computes rule).  The computations are distributed and the
+ * communications are generated automatically.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function boxblur(name);
+
+    var i("i"), j("j");
+
+    boxblur.add_context_constraints("[ROWS]->{: ROWS="+std::to_string(_ROWS)+"}");
+
+    constant ROWS("ROWS", expr((int32_t) _ROWS), p_int32, true, nullptr, 0, &boxblur);
+    constant COLS("COLS", expr((int32_t) _COLS), p_int32, true, nullptr, 0, &boxblur);
+
+    computation img("[ROWS,COLS]->{img[i,j]: 0<=i<ROWS and 0<=j<COLS+2}", expr(), false, p_uint32, &boxblur);
+
+    expr e1 = (img(i, j) + img(i + 1, j) + img(i + 2, j)) / ((uint32_t) 3);
+
+    computation blurx("[ROWS,COLS]->{blurx[i,j]: 0<=i<ROWS and 0<=j<COLS+2}", e1, true, p_uint32, &boxblur);
+
+    expr e2 = (blurx(i, j) + blurx(i, j + 1) + blurx(i, j + 2)) / ((uint32_t) 3);
+
+    computation blury("[ROWS,COLS]->{blury[i,j]: 0<=i<ROWS and 0<=j<COLS}", e2, true, p_uint32, &boxblur);
+
+    blurx.before(blury, computation::root);
+
+    buffer b_img("b_img", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS) + 2}, p_uint32, a_input, &boxblur);
+    buffer b_blurx("b_blurx", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS) + 2}, p_uint32, a_temporary, &boxblur);
+    buffer b_blury("b_blury", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS)}, p_uint32, a_output, &boxblur);
+
+    // Distribute the rows on 10 ranks
+    b_img.distribute({0}, {10});
+    b_blurx.distribute({0}, {10});
+    b_blury.distribute({0}, {10});
+
+    img.set_access("{img[i,j]->b_img[i,j]}");
+    blurx.set_access("{blurx[i,j]->b_blurx[i,j]}");
+    blury.set_access("{blury[i,j]->b_blury[i,j]}");
+
+    boxblur.codegen({&b_img, &b_blury}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("boxblur");
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_182.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Send the rows 2 to 4 of a buffer element by element. The sends are
+ * coalesced automatically into a single message and the rows are stored
+ * in the rows 0 to 2 of the buffer of the receiver.
+ *
+ * A second send is fused with the computation that produces its data at
+ * the innermost loop level: it is not coalesced, otherwise the data would
+ * be sent before it is computed.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function coalesced(name);
+
+    var i("i"), j("j"), q("q");
+
+    computation input("{input[i,j]: 0<=i<" + std::to_string(_N) + " and 0<=j<" + std::to_string(_M) + "}",
+                      expr(), false, p_int32, &coalesced);
+
+    xfer rows = computation::create_xfer("{send[q,i,j]: 0<=q<1 and 2<=i<5 and 0<=j<" + std::to_string(_M) + "}",
+                                         "{recv[q,i,j]: 1<=q<2 and 2<=i<5 and 0<=j<" + std::to_string(_M) + "}",
+                                         q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                         xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), input(i, j), &coalesced);
+
+    computation prod("{prod[q,i,j]: 0<=q<1 and 0<=i<3 and 0<=j<" + std::to_string(_M) + "}",
+                     i * _M + j + 1000, true, p_int32, &coalesced);
+
+    xfer fused = computation::create_xfer("{send_fused[q,i,j]: 0<=q<1 and 0<=i<3 and 0<=j<" + std::to_string(_M) + "}",
+                                          "{recv_fused[q,i,j]: 1<=q<2 and 0<=i<3 and 0<=j<" + std::to_string(_M) + "}",
+                                          q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                          xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), prod(q, i, j), &coalesced);
+
+    rows.s->tag_distribute_level(q);
+    rows.r->tag_distribute_level(q);
+    prod.tag_distribute_level(q);
+    fused.s->tag_distribute_level(q);
+    fused.r->tag_distribute_level(q);
+
+    rows.s->then(*rows.r, computation::root)
+           .then(prod, computation::root)
+           .then(*fused.s, j)
+           .then(*fused.r, computation::root);
+
+    buffer buff("buff", {_N, _M}, p_int32, a_output, &coalesced);
+    buffer buff_fused("buff_fused", {3, _M}, p_int32, a_output, &coalesced);
+
+    input.set_access("{input[i,j]->buff[i,j]}");
+    rows.r->set_access("{recv[q,i,j]->buff[i-2,j]}");
+    prod.set_access("{prod[q,i,j]->buff_fused[i,j]}");
+    fused.r->set_access("{recv_fused[q,i,j]->buff_fused[i,j]}");
+
+    coalesced.codegen({&buff, &buff_fused}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+
+    if (!rows.s->is_collapsed() || !rows.r->is_collapsed())
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The element-wise messages were not coalesced.\033[0m\n", true);
+
+    if (fused.s->is_collapsed() || fused.r->is_collapsed())
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The send fused with its producer was coalesced.\033[0m\n", true);
+}
+
+int main(int argc, char **argv)
+{
+    gen("coalesced_rows");
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_184.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Each rank sends its row 1 to the next rank, which stores it in its row 0,
+ * at each of the _T timesteps.  The communications are persistent: their
+ * requests are created at the first timestep and restarted at the next ones.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function persistent(name);
+
+    var t("t"), q("q"), y("y");
+
+    computation input("{input[x,y]: 0<=x<" + std::to_string(_N) + " and 0<=y<" + std::to_string(_M) + "}",
+                      expr(), false, p_int32, &persistent);
+
+    std::string domain = "0<=t<" + std::to_string(_T) + " and 0<=y<" + std::to_string(_M);
+    xfer halo = computation::create_xfer("{send[t,q,y]: 0<=q<" + std::to_string(_RANKS - 1) + " and " + domain + "}",
+                                         "{recv[t,q,y]: 1<=q<" + std::to_string(_RANKS) + " and " + domain + "}",
+                                         q+1, q-1, xfer_prop(p_int32, {MPI, NONBLOCK, ASYNC, PERSISTENT}),
+                                         xfer_prop(p_int32, {MPI, NONBLOCK, ASYNC, PERSISTENT}), input(1, y),
+                                         &persistent);
+
+    tiramisu::wait wait_send(halo.s->operator()(t, 0, y), xfer_prop(p_wait_ptr, {MPI}), &persistent);
+    tiramisu::wait wait_recv(halo.r->operator()(t, 0, y), xfer_prop(p_wait_ptr, {MPI}), &persistent);
+
+    halo.s->tag_distribute_level(q);
+    halo.r->tag_distribute_level(q);
+    wait_send.tag_distribute_level(q);
+    wait_recv.tag_distribute_level(q);
+
+    halo.s->before(*halo.r, t);
+    halo.r->before(wait_send, t);
+    wait_send.before(wait_recv, t);
+
+    buffer buff("buff", {_N, _M}, p_int32, a_output, &persistent);
+    buffer buff_wait_send("buff_wait_send", {_M}, p_wait_ptr, a_temporary, &persistent);
+    buffer buff_wait_recv("buff_wait_recv", {_M}, p_wait_ptr, a_temporary, &persistent);
+
+    input.set_access("{input[x,y]->buff[x,y]}");
+    halo.r->set_access("{recv[t,q,y]->buff[0,y]}");
+
+    // The same requests are used at each timestep
+    halo.s->set_wait_access("{send[t,q,y]->buff_wait_send[y]}");
+    halo.r->set_wait_access("{recv[t,q,y]->buff_wait_recv[y]}");
+
+    persistent.codegen({&buff}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("persistent_halo");
+    return 0;
+}
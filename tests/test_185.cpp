@@ -0,0 +1,49 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_185.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Each rank writes its row 1 into the row 0 of the next rank with MPI_Put.
+ * The next rank does not receive the data: the exchange is enclosed in two
+ * fences that all the ranks execute.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function rma(name);
+
+    var q("q"), y("y");
+
+    computation input("{input[x,y]: 0<=x<" + std::to_string(_N) + " and 0<=y<" + std::to_string(_M) + "}",
+                      expr(), false, p_int32, &rma);
+
+    xfer halo = computation::create_xfer("{send[q,y]: 0<=q<" + std::to_string(_RANKS - 1) + " and 0<=y<" +
+                                         std::to_string(_M) + "}",
+                                         "{recv[q,y]: 1<=q<" + std::to_string(_RANKS) + " and 0<=y<" +
+                                         std::to_string(_M) + "}",
+                                         q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC, RMA}),
+                                         xfer_prop(p_int32, {MPI, BLOCK, ASYNC, RMA}), input(1, y), &rma);
+
+    halo.s->tag_distribute_level(q);
+    halo.r->tag_distribute_level(q);
+
+    halo.s->before(*halo.r, computation::root);
+
+    buffer buff("buff", {_N, _M}, p_int32, a_output, &rma);
+
+    input.set_access("{input[x,y]->buff[x,y]}");
+    halo.r->set_access("{recv[q,y]->buff[0,y]}");
+
+    rma.codegen({&buff}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("rma_halo");
+    return 0;
+}
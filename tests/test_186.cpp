@@ -0,0 +1,50 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_186.h"
+
+using namespace tiramisu;
+
+/**
+ * Test compiling a function again after the schedule of one of its
+ * computations was modified.  The time-space domain of the computation
+ * whose schedule did not change is not computed again.
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B("B", {i, j}, A(i, j) + (uint8_t) 1);
+    tiramisu::computation C("C", {i, j}, B(i, j) * (uint8_t) 2);
+
+    C.after(B, computation::root);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_output);
+    tiramisu::buffer buff_C("buff_C", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B, &buff_C},
+                      "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + "_untiled.o");
+
+    // Modify the schedule of C and compile again
+    tiramisu::var i0("i0"), j0("j0"), i1("i1"), j1("j1");
+    C.tile(i, j, 2, 2, i0, j0, i1, j1);
+
+    tiramisu::codegen({&buff_A, &buff_B, &buff_C}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
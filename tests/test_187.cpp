@@ -0,0 +1,51 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_187.h"
+
+using namespace tiramisu;
+
+/**
+ * Test the generation of code from a schedule tree: computations
+ * with different numbers of loop levels, fused and tiled.
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+    tiramisu::global::set_schedule_tree_codegen(true);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B("B", {i}, A(i, i) + (uint8_t) 1);
+    tiramisu::computation C("C", {i, j}, A(i, j) * (uint8_t) 2);
+    tiramisu::computation D("D", {i, j}, C(i, j) + B(i));
+
+    // Schedule
+    tiramisu::var i0("i0"), j0("j0"), i1("i1"), j1("j1");
+    C.after(B, i);
+    D.after(C, computation::root);
+    D.tile(i, j, 2, 2, i0, j0, i1, j1);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N}, tiramisu::p_uint8, a_output);
+    tiramisu::buffer buff_C("buff_C", {N, N}, tiramisu::p_uint8, a_output);
+    tiramisu::buffer buff_D("buff_D", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+    D.store_in(&buff_D);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B, &buff_C, &buff_D},
+                      "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_188.h"
+
+using namespace tiramisu;
+
+/**
+ * Test setting the types of the loops generated by the isl AST generator:
+ * full/partial tile separation and unrolling.
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N), k("k", 0, 4);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B("B", {i, j}, A(i, j) + (uint8_t) 1);
+    tiramisu::computation C("C", {i, k}, A(i, k) * (uint8_t) 2);
+
+    // Schedule
+    tiramisu::var i0("i0"), j0("j0"), i1("i1"), j1("j1");
+    B.tile(i, j, 4, 4, i0, j0, i1, j1);
+    B.set_ast_loop_type(i0, tiramisu::ast_loop_separate);
+    B.set_ast_loop_type(j0, tiramisu::ast_loop_separate);
+    C.after(B, computation::root);
+    C.set_ast_loop_type(k, tiramisu::ast_loop_unroll);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_output);
+    tiramisu::buffer buff_C("buff_C", {N, 4}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B, &buff_C},
+                      "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_189.h"
+
+using namespace tiramisu;
+
+/**
+ * Test loop versioning: a version of a tiled computation specialized
+ * for sizes that are multiples of the tile size, and the generic code.
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B("B", {i, j}, A(i, j) + (uint8_t) 1);
+
+    // Schedule
+    tiramisu::var i0("i0"), j0("j0"), i1("i1"), j1("j1");
+    B.tile(i, j, 4, 4, i0, j0, i1, j1);
+    tiramisu::global::get_implicit_function()->add_version("[N]->{: N mod 4 = 0}");
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
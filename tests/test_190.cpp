@@ -0,0 +1,48 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_190.h"
+
+using namespace tiramisu;
+
+/**
+ * Test shape specialization: a tiled computation whose size is read at
+ * runtime, with a version specialized for SIZE1 and a generic version.
+ */
+
+void generate_function(std::string name)
+{
+    tiramisu::init(name);
+    tiramisu::function *fct = tiramisu::global::get_implicit_function();
+
+    // Algorithm
+    tiramisu::computation Sdims("{Sdims[i] : 0 <= i < 1}", tiramisu::expr(), false, p_int32, fct);
+    tiramisu::constant N("N", Sdims(0), p_int32, true, nullptr, computation::root_dimension, fct);
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B("B", {i, j}, A(i, j) + (uint8_t) 1);
+
+    // Schedule
+    tiramisu::var i0("i0"), j0("j0"), i1("i1"), j1("j1");
+    B.tile(i, j, 4, 4, i0, j0, i1, j1);
+
+    tiramisu::buffer buff_dims("buff_dims", {tiramisu::expr(1)}, tiramisu::p_int32, a_input);
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_output);
+    Sdims.store_in(&buff_dims);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+
+    // Code generation
+    std::vector<std::map<std::string, int>> specializations = {{{"N", SIZE1}}};
+    tiramisu::codegen({&buff_dims, &buff_A, &buff_B},
+                      "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o",
+                      specializations);
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code");
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_191.h"
+
+using namespace tiramisu;
+
+/**
+ * Test the batched entry point of a function: a small kernel called
+ * on a batch of buffers.
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+    tiramisu::global::get_implicit_function()->set_batched_entry_point(true);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N);
+    tiramisu::input A("A", {i}, p_int32);
+
+    tiramisu::computation B("B", {i}, A(i) * 2 + 1);
+
+    tiramisu::buffer buff_A("buff_A", {N}, tiramisu::p_int32, a_input);
+    tiramisu::buffer buff_B("buff_B", {N}, tiramisu::p_int32, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
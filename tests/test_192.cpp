@@ -0,0 +1,47 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_192.h"
+
+using namespace tiramisu;
+
+/**
+ * Test streaming: a temporary buffer mapped from a file, produced and
+ * consumed tile by tile (B and C are fused at the tile loop).
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N);
+    tiramisu::input A("A", {i, j}, p_uint8);
+
+    tiramisu::computation B("B", {i, j}, A(i, j) + (uint8_t) 1);
+    tiramisu::computation C("C", {i, j}, B(i, j) * (uint8_t) 2);
+
+    tiramisu::buffer buff_A("buff_A", {N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N, N}, tiramisu::p_uint8, a_temporary);
+    tiramisu::buffer buff_C("buff_C", {N, N}, tiramisu::p_uint8, a_output);
+    buff_B.set_storage_file("build/test_" + std::string(TEST_NUMBER_STR) + "_buff_B.bin");
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+
+    // Schedule
+    tiramisu::var i0("i0"), i1("i1");
+    B.stream(i, 4, {&buff_A, &buff_B}, i0, i1);
+    C.stream(i, 4, {&buff_B, &buff_C}, i0, i1);
+    C.after(B, i0);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_C}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_193.h"
+
+using namespace tiramisu;
+
+/**
+ * Test binding an input buffer to a mapped buffer file (see
+ * mapped_buffer in utils.h).  The generated code is a plain 3D
+ * computation, the mapping is done in the wrapper.
+ */
+
+void generate_function(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N), j("j", 0, N), k("k", 0, N);
+    tiramisu::input A("A", {i, j, k}, p_uint8);
+    tiramisu::computation C("C", {i, j, k}, A(i, j, k) * (uint8_t) 2);
+
+    tiramisu::buffer buff_A("buff_A", {N, N, N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_C("buff_C", {N, N, N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    C.store_in(&buff_C);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_C}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1);
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_194.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Test the block-cyclic distribution of a loop whose extent is not a
+ * multiple of the number of ranks times the block size.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function scale(name);
+
+    var i("i"), ic("ic"), ir("ir"), ib("ib");
+
+    scale.add_context_constraints("[N]->{: N="+std::to_string(_N)+"}");
+
+    constant N("N", expr((int32_t) _N), p_int32, true, nullptr, 0, &scale);
+
+    computation img("[N]->{img[i]: 0<=i<N}", expr(), false, p_uint32, &scale);
+    computation out("[N]->{out[i]: 0<=i<N}", img(i) * ((uint32_t) 2), true, p_uint32, &scale);
+
+    // i -> (ic, ir, ib): rank ir executes the blocks ir, ir + _RANKS, ...
+    img.distribute_block_cyclic(i, _BLOCK, _RANKS, ic, ir, ib);
+    out.distribute_block_cyclic(i, _BLOCK, _RANKS, ic, ir, ib);
+
+    img.drop_rank_iter(ir);
+    out.drop_rank_iter(ir);
+
+    // Each rank stores its blocks contiguously: element (ic, ib).
+    buffer b_img("b_img", {tiramisu::expr(_CYCLES), tiramisu::expr(_BLOCK)}, p_uint32, a_input, &scale);
+    buffer b_out("b_out", {tiramisu::expr(_CYCLES), tiramisu::expr(_BLOCK)}, p_uint32, a_output, &scale);
+
+    std::string cycle = std::to_string(_BLOCK * _RANKS);
+    img.set_access("{img[i]->b_img[floor(i/" + cycle + "), i mod " + cycle + "]}");
+    out.set_access("{out[i]->b_out[floor(i/" + cycle + "), i mod " + cycle + "]}");
+
+    scale.codegen({&b_img, &b_out}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("scale");
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_195.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Test the automatic generation of communication for a computation
+ * distributed on a 2D process grid, with extents that are not multiples
+ * of the tile sizes.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function blur2d(name);
+
+    var i("i"), j("j"), i0("i0"), i1("i1"), j0("j0"), j1("j1");
+
+    blur2d.add_context_constraints("[ROWS,COLS]->{: ROWS="+std::to_string(_ROWS)+" and COLS="+std::to_string(_COLS)+"}");
+    blur2d.set_process_grid({2, 2});
+
+    constant ROWS("ROWS", expr((int32_t) _ROWS), p_int32, true, nullptr, 0, &blur2d);
+    constant COLS("COLS", expr((int32_t) _COLS), p_int32, true, nullptr, 0, &blur2d);
+
+    computation img("[ROWS,COLS]->{img[i,j]: 0<=i<ROWS and 0<=j<COLS}", expr(), false, p_uint32, &blur2d);
+
+    expr e = (img(i, j) + img(i + 1, j) + img(i, j + 1) + img(i + 1, j + 1)) / ((uint32_t) 4);
+
+    computation blur("[ROWS,COLS]->{blur[i,j]: 0<=i<ROWS-1 and 0<=j<COLS-1}", e, true, p_uint32, &blur2d);
+
+    // The last row and the last column of ranks get partial tiles
+    img.tile(i, j, _TILE_ROWS, _TILE_COLS, i0, j0, i1, j1);
+    blur.tile(i, j, _TILE_ROWS, _TILE_COLS, i0, j0, i1, j1);
+
+    img.tag_distribute_level(i0);
+    img.tag_distribute_level(j0);
+    blur.tag_distribute_level(i0);
+    blur.tag_distribute_level(j0);
+
+    img.drop_rank_iter(i0);
+    img.drop_rank_iter(j0);
+    blur.drop_rank_iter(i0);
+    blur.drop_rank_iter(j0);
+
+    buffer b_img("b_img", {tiramisu::expr(_TILE_ROWS), tiramisu::expr(_TILE_COLS)}, p_uint32, a_input, &blur2d);
+    buffer b_blur("b_blur", {tiramisu::expr(_TILE_ROWS), tiramisu::expr(_TILE_COLS)}, p_uint32, a_output, &blur2d);
+
+    img.set_access("{img[i,j]->b_img[i,j]}");
+    blur.set_access("{blur[i,j]->b_blur[i,j]}");
+
+    // Only the ranks of the first row and of the first column of the grid
+    // receive data (b_img becomes (_TILE_ROWS + 1) x (_TILE_COLS + 1)).
+    blur.gen_communication();
+
+    blur2d.codegen({&b_img, &b_blur}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("blur2d");
+    return 0;
+}
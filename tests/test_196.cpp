@@ -0,0 +1,44 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_196.h"
+
+using namespace tiramisu;
+
+/**
+ * Test software prefetching of an indirect access.
+ */
+
+void generate_function(std::string name, int size, int val0)
+{
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::constant N("N", tiramisu::expr((int32_t) size));
+    tiramisu::var i("i", 0, N);
+    tiramisu::input A("A", {i}, p_uint8);
+    tiramisu::input B("B", {i}, p_int32);
+
+    tiramisu::computation C({i}, A(B(i)));
+
+    // Schedule
+    // A(B(i + 16)) is prefetched.  The index B(i + 16) is loaded only in the
+    // iterations i < N - 16.
+    C.prefetch(A, i, 16);
+
+    tiramisu::buffer buff_A("buff_A", {N}, tiramisu::p_uint8, a_input);
+    tiramisu::buffer buff_B("buff_B", {N}, tiramisu::p_int32, a_input);
+    tiramisu::buffer buff_C("buff_C", {N}, tiramisu::p_uint8, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+    C.store_in(&buff_C);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B, &buff_C}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code", SIZE1, 0);
+
+    return 0;
+}
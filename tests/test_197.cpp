@@ -0,0 +1,58 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_197.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Test the reduction and scatter collective communications (allreduce with
+ * the max operator, allgather and alltoall).
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function collectives(name);
+
+    computation local("{local[i]: 0<=i<" + std::to_string(_N) + "}", expr(), false, p_int32, &collectives);
+    computation blocks("{blocks[i]: 0<=i<" + std::to_string(_NUM_RANKS * _CHUNK) + "}", expr(), false, p_int32,
+                       &collectives);
+
+    // The maximum of the local vectors of all the ranks.
+    collective maximum("{maximum[0]}", local(0), xfer_prop(p_int32, {MPI, BLOCK, ALLREDUCE}), {_N},
+                       &collectives, o_max);
+
+    // The local vectors of all the ranks, in the order of the ranks.
+    collective gathered("{gathered[0]}", local(0), xfer_prop(p_int32, {MPI, BLOCK, ALLGATHER}), {_N},
+                        &collectives);
+
+    // The block r of the vector blocks is sent to the rank r.
+    collective exchanged("{exchanged[0]}", blocks(0), xfer_prop(p_int32, {MPI, BLOCK, ALLTOALL}), {_CHUNK},
+                         &collectives);
+
+    maximum.then(gathered, computation::root)
+           .then(exchanged, computation::root);
+
+    buffer b_local("b_local", {_N}, p_int32, a_input, &collectives);
+    buffer b_blocks("b_blocks", {_NUM_RANKS * _CHUNK}, p_int32, a_input, &collectives);
+    buffer b_max("b_max", {_N}, p_int32, a_output, &collectives);
+    buffer b_gathered("b_gathered", {_NUM_RANKS * _N}, p_int32, a_output, &collectives);
+    buffer b_exchanged("b_exchanged", {_NUM_RANKS * _CHUNK}, p_int32, a_output, &collectives);
+
+    local.set_access("{local[i]->b_local[i]}");
+    blocks.set_access("{blocks[i]->b_blocks[i]}");
+    maximum.set_access("{maximum[i]->b_max[i]}");
+    gathered.set_access("{gathered[i]->b_gathered[i]}");
+    exchanged.set_access("{exchanged[i]->b_exchanged[i]}");
+
+    collectives.codegen({&b_local, &b_blocks, &b_max, &b_gathered, &b_exchanged},
+                        "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("collectives");
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_198.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Test non-blocking collective communications (allreduce, broadcast,
+ * allgather and alltoall).
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function collectives(name);
+
+    computation local("{local[i]: 0<=i<" + std::to_string(_N) + "}", expr(), false, p_int32, &collectives);
+    computation shared("{shared[i]: 0<=i<" + std::to_string(_N) + "}", expr(), false, p_int32, &collectives);
+    computation blocks("{blocks[i]: 0<=i<" + std::to_string(_NUM_RANKS * _CHUNK) + "}", expr(), false, p_int32,
+                       &collectives);
+
+    collective sum("{sum[0]}", local(0), xfer_prop(p_int32, {MPI, NONBLOCK, ALLREDUCE}), {_N}, &collectives);
+    collective bcast("{bcast[0]}", shared(0), xfer_prop(p_int32, {MPI, NONBLOCK, BCAST}), {_N}, &collectives,
+                     o_add, 0);
+    collective gathered("{gathered[0]}", local(0), xfer_prop(p_int32, {MPI, NONBLOCK, ALLGATHER}), {_N},
+                        &collectives);
+    collective exchanged("{exchanged[0]}", blocks(0), xfer_prop(p_int32, {MPI, NONBLOCK, ALLTOALL}), {_CHUNK},
+                         &collectives);
+
+    tiramisu::wait wait_sum(sum(0), xfer_prop(p_wait_ptr, {MPI}), &collectives);
+    tiramisu::wait wait_bcast(bcast(0), xfer_prop(p_wait_ptr, {MPI}), &collectives);
+    tiramisu::wait wait_gathered(gathered(0), xfer_prop(p_wait_ptr, {MPI}), &collectives);
+    tiramisu::wait wait_exchanged(exchanged(0), xfer_prop(p_wait_ptr, {MPI}), &collectives);
+
+    // All the collectives are started before any of them is waited on.
+    sum.then(bcast, computation::root)
+       .then(gathered, computation::root)
+       .then(exchanged, computation::root)
+       .then(wait_sum, computation::root)
+       .then(wait_bcast, computation::root)
+       .then(wait_gathered, computation::root)
+       .then(wait_exchanged, computation::root);
+
+    buffer b_local("b_local", {_N}, p_int32, a_input, &collectives);
+    buffer b_blocks("b_blocks", {_NUM_RANKS * _CHUNK}, p_int32, a_input, &collectives);
+    buffer b_shared("b_shared", {_N}, p_int32, a_output, &collectives);
+    buffer b_sum("b_sum", {_N}, p_int32, a_output, &collectives);
+    buffer b_gathered("b_gathered", {_NUM_RANKS * _N}, p_int32, a_output, &collectives);
+    buffer b_exchanged("b_exchanged", {_NUM_RANKS * _CHUNK}, p_int32, a_output, &collectives);
+    buffer b_wait_sum("b_wait_sum", {1}, p_wait_ptr, a_temporary, &collectives);
+    buffer b_wait_bcast("b_wait_bcast", {1}, p_wait_ptr, a_temporary, &collectives);
+    buffer b_wait_gathered("b_wait_gathered", {1}, p_wait_ptr, a_temporary, &collectives);
+    buffer b_wait_exchanged("b_wait_exchanged", {1}, p_wait_ptr, a_temporary, &collectives);
+
+    local.set_access("{local[i]->b_local[i]}");
+    shared.set_access("{shared[i]->b_shared[i]}");
+    blocks.set_access("{blocks[i]->b_blocks[i]}");
+    sum.set_access("{sum[i]->b_sum[i]}");
+    gathered.set_access("{gathered[i]->b_gathered[i]}");
+    exchanged.set_access("{exchanged[i]->b_exchanged[i]}");
+
+    sum.set_wait_access("{sum[i]->b_wait_sum[i]}");
+    bcast.set_wait_access("{bcast[i]->b_wait_bcast[i]}");
+    gathered.set_wait_access("{gathered[i]->b_wait_gathered[i]}");
+    exchanged.set_wait_access("{exchanged[i]->b_wait_exchanged[i]}");
+
+    collectives.codegen({&b_local, &b_blocks, &b_shared, &b_sum, &b_gathered, &b_exchanged},
+                        "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("collectives");
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_199.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Each rank sends its rows to the next rank.  The send and the receive are
+ * inside a loop over the rows that is tagged as parallel, so several threads
+ * call MPI at the same time.  Each element has its own message tag, so the
+ * order in which the threads communicate does not matter.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function parallel_rows(name);
+
+    var q("q"), i("i"), y("y");
+
+    computation input("{input[i,y]: 0<=i<" + std::to_string(_N) + " and 0<=y<" + std::to_string(_M) + "}",
+                      expr(), false, p_int32, &parallel_rows);
+
+    std::string domain = "0<=i<" + std::to_string(_N) + " and 0<=y<" + std::to_string(_M);
+    xfer rows = computation::create_xfer("{send[q,i,y]: 0<=q<" + std::to_string(_RANKS - 1) + " and " + domain + "}",
+                                         "{recv[q,i,y]: 1<=q<" + std::to_string(_RANKS) + " and " + domain + "}",
+                                         q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                         xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), input(i, y), &parallel_rows);
+    rows.s->override_msg_tag(i * _M + y);
+    rows.r->override_msg_tag(i * _M + y);
+
+    rows.s->tag_distribute_level(q);
+    rows.r->tag_distribute_level(q);
+
+    rows.s->tag_parallel_level(i);
+    rows.r->tag_parallel_level(i);
+
+    rows.s->before(*rows.r, computation::root);
+
+    buffer b_input("b_input", {_N, _M}, p_int32, a_input, &parallel_rows);
+    buffer b_output("b_output", {_N, _M}, p_int32, a_output, &parallel_rows);
+
+    input.set_access("{input[i,y]->b_input[i,y]}");
+    rows.r->set_access("{recv[q,i,y]->b_output[i,y]}");
+
+    parallel_rows.codegen({&b_input, &b_output}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("parallel_rows");
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include <tiramisu/tiramisu.h>
+
+#include "wrapper_test_200.h"
+
+using namespace tiramisu;
+
+/**
+ * Test the runtime debugging levels: the code generation runs with all the
+ * debugging levels set to 0 except the one of the module "core".  The
+ * parsing of TIRAMISU_DEBUG_LEVEL is checked by the wrapper.
+ */
+
+void generate_function(std::string name)
+{
+    tiramisu::set_debug_level(0);
+    tiramisu::set_debug_level("core", 1);
+
+    tiramisu::init(name);
+
+    // Algorithm
+    tiramisu::var i("i", 0, SIZE1);
+    tiramisu::input A("A", {i}, p_int32);
+    tiramisu::computation B("B", {i}, A(i) + 1);
+
+    // Layer III
+    tiramisu::buffer buff_A("buff_A", {SIZE1}, tiramisu::p_int32, a_input);
+    tiramisu::buffer buff_B("buff_B", {SIZE1}, tiramisu::p_int32, a_output);
+    A.store_in(&buff_A);
+    B.store_in(&buff_B);
+
+    // Code generation
+    tiramisu::codegen({&buff_A, &buff_B}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    generate_function("tiramisu_generated_code");
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_201.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Each rank computes _ROWS/_RANKS rows of blurx, which reads the two first
+ * rows of the next rank.  gen_overlapped_communication() should compute the
+ * rows that do not need these rows (the interior region) before waiting for
+ * the communications, and the two last rows (the boundary region) after.
+ */
+
+#define _BLOCK (_ROWS/_RANKS)
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function overlapped_blur(name);
+
+    var i("i"), j("j"), i0("i0"), i1("i1");
+
+    overlapped_blur.add_context_constraints("[ROWS]->{: ROWS="+std::to_string(_ROWS)+"}");
+
+    constant ROWS("ROWS", expr((int32_t) _ROWS), p_int32, true, nullptr, 0, &overlapped_blur);
+    constant COLS("COLS", expr((int32_t) _COLS), p_int32, true, nullptr, 0, &overlapped_blur);
+
+    computation img("[ROWS,COLS]->{img[i,j]: 0<=i<ROWS and 0<=j<COLS+2}", expr(), false, p_uint32, &overlapped_blur);
+
+    expr e1 = (img(i, j) + img(i + 1, j) + img(i + 2, j)) / ((uint32_t) 3);
+
+    computation blurx("[ROWS,COLS]->{blurx[i,j]: 0<=i<ROWS and 0<=j<COLS+2}", e1, true, p_uint32, &overlapped_blur);
+
+    expr e2 = (blurx(i, j) + blurx(i, j + 1) + blurx(i, j + 2)) / ((uint32_t) 3);
+
+    computation blury("[ROWS,COLS]->{blury[i,j]: 0<=i<ROWS and 0<=j<COLS}", e2, true, p_uint32, &overlapped_blur);
+
+    img.split(i, _BLOCK, i0, i1);
+    blurx.split(i, _BLOCK, i0, i1);
+    blury.split(i, _BLOCK, i0, i1);
+
+    img.tag_distribute_level(i0);
+    blurx.tag_distribute_level(i0);
+    blury.tag_distribute_level(i0);
+
+    img.drop_rank_iter(i0);
+    blurx.drop_rank_iter(i0);
+    blury.drop_rank_iter(i0);
+
+    blurx.before(blury, i0);
+
+    buffer b_img("b_img", {tiramisu::expr(_BLOCK), tiramisu::expr(_COLS) + 2}, p_uint32, a_input, &overlapped_blur);
+    buffer b_blurx("b_blurx", {tiramisu::expr(_BLOCK), tiramisu::expr(_COLS) + 2}, p_uint32, a_temporary, &overlapped_blur);
+    buffer b_blury("b_blury", {tiramisu::expr(_BLOCK), tiramisu::expr(_COLS)}, p_uint32, a_output, &overlapped_blur);
+
+    img.set_access("{img[i,j]->b_img[i,j]}");
+    blurx.set_access("{blurx[i,j]->b_blurx[i,j]}");
+    blury.set_access("{blury[i,j]->b_blury[i,j]}");
+
+    blurx.gen_overlapped_communication();
+
+    // The boundary region is the two last rows of each rank
+    computation &boundary = blurx.get_last_update();
+    if (&boundary == &blurx)
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The computation was not split.\033[0m\n", true);
+
+    std::string bounds = "[ROWS,COLS]->{blurx[i,j]: 0<=i<ROWS and 0<=j<COLS+2 and ROWS=" + std::to_string(_ROWS) +
+                         " and COLS=" + std::to_string(_COLS);
+    isl_set *expected_boundary = isl_set_read_from_str(overlapped_blur.get_isl_ctx(),
+        (bounds + " and i mod " + std::to_string(_BLOCK) + ">=" + std::to_string(_BLOCK - 2) + "}").c_str());
+    isl_set *expected_interior = isl_set_read_from_str(overlapped_blur.get_isl_ctx(),
+        (bounds + " and i mod " + std::to_string(_BLOCK) + "<" + std::to_string(_BLOCK - 2) + "}").c_str());
+    isl_set *context = isl_set_read_from_str(overlapped_blur.get_isl_ctx(),
+        ("[ROWS,COLS]->{: ROWS=" + std::to_string(_ROWS) + " and COLS=" + std::to_string(_COLS) + "}").c_str());
+    isl_set *boundary_domain = isl_set_intersect_params(isl_map_domain(isl_map_copy(boundary.get_schedule())),
+                                                        isl_set_copy(context));
+    isl_set *interior_domain = isl_set_intersect_params(isl_map_domain(isl_map_copy(blurx.get_schedule())),
+                                                        context);
+    if (isl_set_is_equal(boundary_domain, expected_boundary) != isl_bool_true ||
+        isl_set_is_equal(interior_domain, expected_interior) != isl_bool_true)
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. Wrong interior or boundary region.\033[0m\n", true);
+    isl_set_free(boundary_domain);
+    isl_set_free(interior_domain);
+    isl_set_free(expected_boundary);
+    isl_set_free(expected_interior);
+
+    // The waits on the send and on the receive are between the two regions
+    computation *second_wait = boundary.get_predecessor();
+    computation *first_wait = (second_wait != nullptr) ? second_wait->get_predecessor() : nullptr;
+    if (second_wait == nullptr || !second_wait->is_wait() ||
+        first_wait == nullptr || !first_wait->is_wait() || first_wait->get_predecessor() != &blurx)
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The requests are not waited on before the boundary region.\033[0m\n", true);
+
+    overlapped_blur.codegen({&b_img, &b_blury}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("overlapped_blur");
+    return 0;
+}
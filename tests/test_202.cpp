@@ -0,0 +1,64 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_202.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Same as test_195 but the data distribution is described on the buffers:
+ * both dimensions of the buffers are distributed on a 2x2 process grid, so
+ * the two loop levels of each computation are split and the distributed
+ * loop levels are interchanged to be consecutive.  The function is
+ * compiled twice to check that the buffers are distributed only once.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function blur2d(name);
+
+    var i("i"), j("j");
+
+    blur2d.add_context_constraints("[ROWS,COLS]->{: ROWS="+std::to_string(_ROWS)+" and COLS="+std::to_string(_COLS)+"}");
+
+    constant ROWS("ROWS", expr((int32_t) _ROWS), p_int32, true, nullptr, 0, &blur2d);
+    constant COLS("COLS", expr((int32_t) _COLS), p_int32, true, nullptr, 0, &blur2d);
+
+    computation img("[ROWS,COLS]->{img[i,j]: 0<=i<ROWS and 0<=j<COLS}", expr(), false, p_uint32, &blur2d);
+
+    expr e = (img(i, j) + img(i + 1, j) + img(i, j + 1) + img(i + 1, j + 1)) / ((uint32_t) 4);
+
+    computation blur("[ROWS,COLS]->{blur[i,j]: 0<=i<ROWS-1 and 0<=j<COLS-1}", e, true, p_uint32, &blur2d);
+
+    buffer b_img("b_img", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS)}, p_uint32, a_input, &blur2d);
+    buffer b_blur("b_blur", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS)}, p_uint32, a_output, &blur2d);
+
+    // The last row and the last column of ranks get partial tiles
+    b_img.distribute({0, 1}, {2, 2});
+    b_blur.distribute({0, 1}, {2, 2});
+
+    img.set_access("{img[i,j]->b_img[i,j]}");
+    blur.set_access("{blur[i,j]->b_blur[i,j]}");
+
+    blur2d.codegen({&b_img, &b_blur}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+
+    if ((b_blur.get_dim_sizes()[0].get_int_val() != _TILE_ROWS) ||
+        (b_blur.get_dim_sizes()[1].get_int_val() != _TILE_COLS))
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The output buffer was not resized to the tile size.\033[0m\n", true);
+
+    // Recompiling should not split the computations or resize the buffers again
+    // (b_img also holds the received row and column, see test_195)
+    blur2d.codegen({&b_img, &b_blur}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+
+    if ((b_blur.get_dim_sizes()[0].get_int_val() != _TILE_ROWS) ||
+        (b_blur.get_dim_sizes()[1].get_int_val() != _TILE_COLS))
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The output buffer was resized again by the second codegen().\033[0m\n", true);
+}
+
+int main(int argc, char **argv)
+{
+    gen("blur2d");
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+#include "wrapper_test_203.h"
+
+#include <Halide.h>
+using namespace tiramisu;
+
+/**
+ * Same as test_202 but the ranks of the 2x2 process grid are numbered in
+ * column-major order: the rank 1 owns the bottom-left tile and the rank 2
+ * owns the top-right tile.
+ */
+
+void gen(std::string name)
+{
+    global::set_default_tiramisu_options();
+
+    function blur2d(name);
+
+    var i("i"), j("j");
+
+    blur2d.add_context_constraints("[ROWS,COLS]->{: ROWS="+std::to_string(_ROWS)+" and COLS="+std::to_string(_COLS)+"}");
+
+    constant ROWS("ROWS", expr((int32_t) _ROWS), p_int32, true, nullptr, 0, &blur2d);
+    constant COLS("COLS", expr((int32_t) _COLS), p_int32, true, nullptr, 0, &blur2d);
+
+    computation img("[ROWS,COLS]->{img[i,j]: 0<=i<ROWS and 0<=j<COLS}", expr(), false, p_uint32, &blur2d);
+
+    expr e = (img(i, j) + img(i + 1, j) + img(i, j + 1) + img(i + 1, j + 1)) / ((uint32_t) 4);
+
+    computation blur("[ROWS,COLS]->{blur[i,j]: 0<=i<ROWS-1 and 0<=j<COLS-1}", e, true, p_uint32, &blur2d);
+
+    buffer b_img("b_img", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS)}, p_uint32, a_input, &blur2d);
+    buffer b_blur("b_blur", {tiramisu::expr(_ROWS), tiramisu::expr(_COLS)}, p_uint32, a_output, &blur2d);
+
+    b_img.distribute({0, 1}, {2, 2}, {}, l_column_major);
+    b_blur.distribute({0, 1}, {2, 2}, {}, l_column_major);
+
+    img.set_access("{img[i,j]->b_img[i,j]}");
+    blur.set_access("{blur[i,j]->b_blur[i,j]}");
+
+    blur2d.codegen({&b_img, &b_blur}, "build/generated_fct_test_" + std::string(TEST_NUMBER_STR) + ".o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("blur2d");
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_173.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+int main(int, char **)
+{
+    // A position-dependent input, so that reading a wrong element of A or
+    // of the scratch buffer of a tile is detected.
+    Halide::Buffer<uint8_t> input_buf0(SIZE1, SIZE1, "input_buf0");
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1; j++)
+            input_buf0(j, i) = (uint8_t) (i * 7 + j * 3 + 1);
+
+    Halide::Buffer<uint8_t> bx_buf0(SIZE1, SIZE1, "bx_buf0");
+    init_buffer(bx_buf0, (uint8_t)0);
+
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1-2; j++)
+            bx_buf0(j, i) = input_buf0(j, i) + input_buf0(j + 1, i) + input_buf0(j + 2, i);
+
+    Halide::Buffer<uint8_t> reference_buf0(SIZE1, SIZE1, "reference_buf0");
+    init_buffer(reference_buf0, (uint8_t)0);
+
+    for (int i = 0; i < SIZE1-2; i++)
+        for (int j = 0; j < SIZE1-2; j++)
+            reference_buf0(j, i) = bx_buf0(j, i) + bx_buf0(j, i + 1) + bx_buf0(j, i + 2);
+
+    Halide::Buffer<uint8_t> output_buf0(SIZE1, SIZE1, "output_buf0");
+    init_buffer(output_buf0, (uint8_t)0);
+
+    // Call the Tiramisu generated code
+    tiramisu_generated_code(input_buf0.raw_buffer(), output_buf0.raw_buffer());
+
+    compare_buffers(std::string(TEST_NAME_STR), output_buf0, reference_buf0);
+
+    return 0;
+}
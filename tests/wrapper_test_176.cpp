@@ -0,0 +1,42 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_176.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+int main(int, char **)
+{
+    Halide::Buffer<uint8_t> A(SIZE1, SIZE1, "A");
+    Halide::Buffer<uint8_t> B(SIZE1, SIZE1, "B");
+    Halide::Buffer<uint8_t> reference_buf0(SIZE1, SIZE1, "reference_buf0");
+
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1; j++)
+        {
+            A(j, i) = i * SIZE1 + j;
+            B(j, i) = i + j;
+        }
+
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1; j++)
+            reference_buf0(j, i) = A(i, j) + B(j, i);
+
+    Halide::Buffer<uint8_t> output_buf0(SIZE1, SIZE1, "output_buf0");
+    init_buffer(output_buf0, (uint8_t)0);
+
+    // Call the Tiramisu generated code
+    tiramisu_generated_code(A.raw_buffer(), B.raw_buffer(), output_buf0.raw_buffer());
+
+    compare_buffers(std::string(TEST_NAME_STR), output_buf0, reference_buf0);
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "wrapper_test_177.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  // Coordinates of the rank in the 2x2 process grid
+  int ci = rank / 2;
+  int cj = rank % 2;
+
+  // The local block and one extra row and column for the received data
+  Halide::Buffer<uint32_t> img(_COLS/2 + 1, _ROWS/2 + 1, "img");
+  init_buffer(img, (uint32_t)0);
+
+  for (int r = 0; r < _ROWS/2; r++) {
+    for (int c = 0; c < _COLS/2; c++) {
+      img(c, r) = (ci * _ROWS/2 + r) + (cj * _COLS/2 + c);
+    }
+  }
+
+  Halide::Buffer<uint32_t> output(_COLS/2, _ROWS/2, "output");
+  Halide::Buffer<uint32_t> reference(_COLS/2, _ROWS/2, "reference");
+
+  init_buffer(output, (uint32_t)0);
+  init_buffer(reference, (uint32_t)0);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  blur2d(img.raw_buffer(), output.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  for (int r = 0; r < _ROWS/2; r++) {
+    for (int c = 0; c < _COLS/2; c++) {
+      int gi = ci * _ROWS/2 + r;
+      int gj = cj * _COLS/2 + c;
+      if (gi < _ROWS - 1 && gj < _COLS - 1)
+        reference(c, r) = ((gi + gj) + (gi + 1 + gj) + (gi + gj + 1) + (gi + 1 + gj + 1)) / 4;
+    }
+  }
+
+  compare_buffers(std::string(TEST_NAME_STR) + std::to_string(rank), output, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
@@ -0,0 +1,41 @@
+#include "wrapper_test_178.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+  int number_of_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks);
+
+  Halide::Buffer<double> local(_N, "local");
+  Halide::Buffer<double> shared(_N, "shared");
+  Halide::Buffer<double> sum(_N, "sum");
+  Halide::Buffer<double> reference_sum(_N, "reference_sum");
+  Halide::Buffer<double> reference_shared(_N, "reference_shared");
+
+  for (int i = 0; i < _N; i++) {
+    local(i) = rank + i;
+    shared(i) = (rank == 0) ? i : -1;
+    sum(i) = 0;
+    // sum over r of (r + i)
+    reference_sum(i) = number_of_ranks * (number_of_ranks - 1) / 2 + number_of_ranks * i;
+    reference_shared(i) = i;
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  collectives(local.raw_buffer(), shared.raw_buffer(), sum.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " (allreduce) " + std::to_string(rank), sum, reference_sum);
+  compare_buffers(std::string(TEST_NAME_STR) + " (broadcast) " + std::to_string(rank), shared, reference_shared);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
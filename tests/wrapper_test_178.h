@@ -0,0 +1,26 @@
+#ifndef TIRAMISU_WRAPPER_TEST_178_H
+#define TIRAMISU_WRAPPER_TEST_178_H
+
+#define TEST_NAME_STR       "Collective communications"
+#define TEST_NUMBER_STR     "178"
+
+//data size
+#define _N 10
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int collectives(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer, halide_buffer_t *_p2_buffer);
+int collectives_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,39 @@
+#include "wrapper_test_180.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  Halide::Buffer<int32_t> buff(_M, _N, "buff");
+  Halide::Buffer<int32_t> reference(_M, _N, "reference");
+
+  for (int i = 0; i < _N; i++) {
+    for (int j = 0; j < _M; j++) {
+      buff(j, i) = (rank == 0) ? i * _M + j : -1;
+      reference(j, i) = buff(j, i);
+    }
+  }
+  if (rank == 1) {
+    // The first column of the rank 0 is stored in the last column
+    for (int i = 0; i < _N; i++) {
+      reference(_M - 1, i) = i * _M;
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  strided_column(buff.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " " + std::to_string(rank), buff, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
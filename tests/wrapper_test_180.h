@@ -0,0 +1,27 @@
+#ifndef TIRAMISU_WRAPPER_TEST_180_H
+#define TIRAMISU_WRAPPER_TEST_180_H
+
+#define TEST_NAME_STR       "Strided communication with a derived datatype"
+#define TEST_NUMBER_STR     "180"
+
+//data size
+#define _N 10
+#define _M 20
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int strided_column(halide_buffer_t *_p0_buffer);
+int strided_column_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,53 @@
+#include "wrapper_test_182.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  Halide::Buffer<int32_t> buff(_M, _N, "buff");
+  Halide::Buffer<int32_t> reference(_M, _N, "reference");
+
+  for (int i = 0; i < _N; i++) {
+    for (int j = 0; j < _M; j++) {
+      buff(j, i) = (rank == 0) ? i * _M + j : -1;
+      reference(j, i) = buff(j, i);
+    }
+  }
+  if (rank == 1) {
+    // The rows 2 to 4 of the rank 0 are stored in the rows 0 to 2
+    for (int i = 2; i < 5; i++) {
+      for (int j = 0; j < _M; j++) {
+        reference(j, i - 2) = i * _M + j;
+      }
+    }
+  }
+
+  // Computed by the rank 0 and received element by element by the rank 1
+  Halide::Buffer<int32_t> buff_fused(_M, 3, "buff_fused");
+  Halide::Buffer<int32_t> reference_fused(_M, 3, "reference_fused");
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < _M; j++) {
+      buff_fused(j, i) = -1;
+      reference_fused(j, i) = i * _M + j + 1000;
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  coalesced_rows(buff.raw_buffer(), buff_fused.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " " + std::to_string(rank), buff, reference);
+  compare_buffers(std::string(TEST_NAME_STR) + " (fused) " + std::to_string(rank), buff_fused, reference_fused);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
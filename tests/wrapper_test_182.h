@@ -0,0 +1,27 @@
+#ifndef TIRAMISU_WRAPPER_TEST_182_H
+#define TIRAMISU_WRAPPER_TEST_182_H
+
+#define TEST_NAME_STR       "Automatic coalescing of element-wise messages"
+#define TEST_NUMBER_STR     "182"
+
+//data size
+#define _N 10
+#define _M 20
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int coalesced_rows(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer);
+int coalesced_rows_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
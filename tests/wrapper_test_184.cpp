@@ -0,0 +1,41 @@
+#include "wrapper_test_184.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  Halide::Buffer<int32_t> buff(_M, _N, "buff");
+  Halide::Buffer<int32_t> reference(_M, _N, "reference");
+
+  for (int i = 0; i < _N; i++) {
+    for (int j = 0; j < _M; j++) {
+      buff(j, i) = rank * _N + i;
+      reference(j, i) = buff(j, i);
+    }
+  }
+  if (rank > 0) {
+    // The row 1 of the previous rank is stored in the row 0
+    for (int j = 0; j < _M; j++) {
+      reference(j, 0) = (rank - 1) * _N + 1;
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  // Call the function twice: the persistent requests are also reused across calls
+  persistent_halo(buff.raw_buffer());
+  persistent_halo(buff.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " " + std::to_string(rank), buff, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
@@ -0,0 +1,29 @@
+#ifndef TIRAMISU_WRAPPER_TEST_184_H
+#define TIRAMISU_WRAPPER_TEST_184_H
+
+#define TEST_NAME_STR       "Persistent communication requests"
+#define TEST_NUMBER_STR     "184"
+
+//data size
+#define _RANKS 4
+#define _T 5
+#define _N 10
+#define _M 20
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int persistent_halo(halide_buffer_t *_p0_buffer);
+int persistent_halo_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef TIRAMISU_WRAPPER_TEST_185_H
+#define TIRAMISU_WRAPPER_TEST_185_H
+
+#define TEST_NAME_STR       "One-sided communications"
+#define TEST_NUMBER_STR     "185"
+
+//data size
+#define _RANKS 4
+#define _N 10
+#define _M 20
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int rma_halo(halide_buffer_t *_p0_buffer);
+int rma_halo_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
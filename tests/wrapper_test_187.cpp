@@ -0,0 +1,53 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_187.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+int main(int, char **)
+{
+    Halide::Buffer<uint8_t> A(SIZE1, SIZE1, "A");
+    Halide::Buffer<uint8_t> reference_B(SIZE1, "reference_B");
+    Halide::Buffer<uint8_t> reference_C(SIZE1, SIZE1, "reference_C");
+    Halide::Buffer<uint8_t> reference_D(SIZE1, SIZE1, "reference_D");
+
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1; j++)
+            A(j, i) = (i + j) % 10;
+
+    for (int i = 0; i < SIZE1; i++)
+    {
+        reference_B(i) = A(i, i) + 1;
+        for (int j = 0; j < SIZE1; j++)
+        {
+            reference_C(j, i) = A(j, i) * 2;
+            reference_D(j, i) = reference_C(j, i) + reference_B(i);
+        }
+    }
+
+    Halide::Buffer<uint8_t> output_B(SIZE1, "output_B");
+    Halide::Buffer<uint8_t> output_C(SIZE1, SIZE1, "output_C");
+    Halide::Buffer<uint8_t> output_D(SIZE1, SIZE1, "output_D");
+    init_buffer(output_B, (uint8_t)0);
+    init_buffer(output_C, (uint8_t)0);
+    init_buffer(output_D, (uint8_t)0);
+
+    // Call the Tiramisu generated code
+    tiramisu_generated_code(A.raw_buffer(), output_B.raw_buffer(),
+                            output_C.raw_buffer(), output_D.raw_buffer());
+
+    compare_buffers(std::string(TEST_NAME_STR) + " (B)", output_B, reference_B);
+    compare_buffers(std::string(TEST_NAME_STR) + " (C)", output_C, reference_C);
+    compare_buffers(std::string(TEST_NAME_STR) + " (D)", output_D, reference_D);
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_189.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+int main(int, char **)
+{
+    Halide::Buffer<uint8_t> A(SIZE1, SIZE1, "A");
+    Halide::Buffer<uint8_t> reference_B(SIZE1, SIZE1, "reference_B");
+
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1; j++)
+        {
+            A(j, i) = i + j;
+            reference_B(j, i) = A(j, i) + 1;
+        }
+
+    Halide::Buffer<uint8_t> output_B(SIZE1, SIZE1, "output_B");
+    init_buffer(output_B, (uint8_t)0);
+
+    // Call the Tiramisu generated code
+    tiramisu_generated_code(A.raw_buffer(), output_B.raw_buffer());
+
+    compare_buffers(std::string(TEST_NAME_STR), output_B, reference_B);
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_190.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+void run_test(int size, const std::string &name)
+{
+    Halide::Buffer<int32_t> dims(1, "dims");
+    Halide::Buffer<uint8_t> A(size, size, "A");
+    Halide::Buffer<uint8_t> reference_B(size, size, "reference_B");
+
+    dims(0) = size;
+    for (int i = 0; i < size; i++)
+        for (int j = 0; j < size; j++)
+        {
+            A(j, i) = i + j;
+            reference_B(j, i) = A(j, i) + 1;
+        }
+
+    Halide::Buffer<uint8_t> output_B(size, size, "output_B");
+    init_buffer(output_B, (uint8_t)0);
+
+    // Call the Tiramisu generated code
+    tiramisu_generated_code(dims.raw_buffer(), A.raw_buffer(), output_B.raw_buffer());
+
+    compare_buffers(std::string(TEST_NAME_STR) + name, output_B, reference_B);
+}
+
+int main(int, char **)
+{
+    // The specialized version.
+    run_test(SIZE1, " (specialized)");
+
+    // The generic version.
+    run_test(SIZE2, " (generic)");
+
+    return 0;
+}
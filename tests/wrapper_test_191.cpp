@@ -0,0 +1,54 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_191.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+int main(int, char **)
+{
+    std::vector<Halide::Buffer<int32_t>> A, output, reference;
+    std::vector<halide_buffer_t *> A_batch, output_batch;
+
+    for (int b = 0; b < BATCH_SIZE; b++)
+    {
+        A.push_back(Halide::Buffer<int32_t>(SIZE1));
+        output.push_back(Halide::Buffer<int32_t>(SIZE1));
+        reference.push_back(Halide::Buffer<int32_t>(SIZE1));
+
+        for (int i = 0; i < SIZE1; i++)
+        {
+            A[b](i) = b * SIZE1 + i;
+            reference[b](i) = A[b](i) * 2 + 1;
+        }
+        init_buffer(output[b], (int32_t)0);
+    }
+
+    for (int b = 0; b < BATCH_SIZE; b++)
+    {
+        A_batch.push_back(A[b].raw_buffer());
+        output_batch.push_back(output[b].raw_buffer());
+    }
+
+    // Call the batched entry point of the Tiramisu generated code
+    int ret = tiramisu_generated_code_batched(BATCH_SIZE, A_batch.data(), output_batch.data());
+    if (ret != 0)
+    {
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. The batched entry point returned " +
+              std::to_string(ret) + ".\033[0m\n", true);
+    }
+
+    for (int b = 0; b < BATCH_SIZE; b++)
+        compare_buffers(std::string(TEST_NAME_STR) + " (element " + std::to_string(b) + ")",
+                        output[b], reference[b]);
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+#ifndef TIRAMISU_test_h
+#define TIRAMISU_test_h
+
+
+// Define these values for each new test
+#define TEST_NAME_STR       "batched entry point"
+#define TEST_NUMBER_STR     "191"
+// Data size
+#define SIZE0 1
+#define SIZE1 10
+#define BATCH_SIZE 16
+
+
+// --------------------------------------------------------
+// No need to modify anything in the following ------------
+// --------------------------------------------------------
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int tiramisu_generated_code(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer);
+int tiramisu_generated_code_argv(void **args);
+int tiramisu_generated_code_batched(int32_t batch_size, void *_p0_batch, void *_p1_batch);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+#endif
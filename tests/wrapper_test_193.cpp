@@ -0,0 +1,49 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_193.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+int main(int, char **)
+{
+    std::string file_name = "build/test_" + std::string(TEST_NUMBER_STR) + "_A.bin";
+
+    Halide::Buffer<uint8_t> A(SIZE1, SIZE1, SIZE1, "A");
+    Halide::Buffer<uint8_t> reference_buf0(SIZE1, SIZE1, SIZE1, "reference_buf0");
+
+    for (int i = 0; i < SIZE1; i++)
+        for (int j = 0; j < SIZE1; j++)
+            for (int k = 0; k < SIZE1; k++)
+            {
+                A(k, j, i) = i + j + k;
+                reference_buf0(k, j, i) = A(k, j, i) * 2;
+            }
+
+    save_buffer(A, file_name);
+
+    {
+        mapped_buffer<uint8_t> mapped_A(file_name, buffer_file_sequential, true);
+
+        Halide::Buffer<uint8_t> output_buf0(SIZE1, SIZE1, SIZE1, "output_buf0");
+        init_buffer(output_buf0, (uint8_t)0);
+
+        // Call the Tiramisu generated code
+        tiramisu_generated_code(mapped_A.raw_buffer(), output_buf0.raw_buffer());
+
+        compare_buffers(std::string(TEST_NAME_STR), output_buf0, reference_buf0);
+    }
+
+    std::remove(file_name.c_str());
+
+    return 0;
+}
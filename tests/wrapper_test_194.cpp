@@ -0,0 +1,43 @@
+#include "wrapper_test_194.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  Halide::Buffer<uint32_t> img(_BLOCK, _CYCLES, "img");
+  Halide::Buffer<uint32_t> output(_BLOCK, _CYCLES, "output");
+  Halide::Buffer<uint32_t> reference(_BLOCK, _CYCLES, "reference");
+
+  init_buffer(img, (uint32_t)0);
+  init_buffer(output, (uint32_t)0);
+  init_buffer(reference, (uint32_t)0);
+
+  // The element b of the block of the cycle c is the global element
+  // c * _BLOCK * _RANKS + rank * _BLOCK + b (if it exists)
+  for (int c = 0; c < _CYCLES; c++) {
+    for (int b = 0; b < _BLOCK; b++) {
+      int g = c * _BLOCK * _RANKS + rank * _BLOCK + b;
+      if (g < _N) {
+        img(b, c) = g;
+        reference(b, c) = g * 2;
+      }
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  scale(img.raw_buffer(), output.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + std::to_string(rank), output, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
@@ -0,0 +1,29 @@
+#ifndef TIRAMISU_WRAPPER_TEST_194_H
+#define TIRAMISU_WRAPPER_TEST_194_H
+
+#define TEST_NAME_STR       "Block-cyclic distribution with a partial last cycle"
+#define TEST_NUMBER_STR     "194"
+
+//data size
+#define _N 45
+#define _BLOCK 4
+#define _RANKS 4
+#define _CYCLES ((_N + _BLOCK * _RANKS - 1) / (_BLOCK * _RANKS))
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int scale(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer);
+int scale_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
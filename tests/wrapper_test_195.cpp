@@ -0,0 +1,56 @@
+#include "wrapper_test_195.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  // Coordinates of the rank in the 2x2 process grid
+  int ci = rank / 2;
+  int cj = rank % 2;
+
+  // Size of the local tile (the tiles of the last row and column are partial)
+  int rows = (ci == 0) ? _TILE_ROWS : _ROWS - _TILE_ROWS;
+  int cols = (cj == 0) ? _TILE_COLS : _COLS - _TILE_COLS;
+
+  // The local tile and one extra row and column for the received data
+  Halide::Buffer<uint32_t> img(_TILE_COLS + 1, _TILE_ROWS + 1, "img");
+  init_buffer(img, (uint32_t)0);
+
+  for (int r = 0; r < rows; r++) {
+    for (int c = 0; c < cols; c++) {
+      img(c, r) = (ci * _TILE_ROWS + r) + (cj * _TILE_COLS + c);
+    }
+  }
+
+  Halide::Buffer<uint32_t> output(_TILE_COLS, _TILE_ROWS, "output");
+  Halide::Buffer<uint32_t> reference(_TILE_COLS, _TILE_ROWS, "reference");
+
+  init_buffer(output, (uint32_t)0);
+  init_buffer(reference, (uint32_t)0);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  blur2d(img.raw_buffer(), output.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  for (int r = 0; r < rows; r++) {
+    for (int c = 0; c < cols; c++) {
+      int gi = ci * _TILE_ROWS + r;
+      int gj = cj * _TILE_COLS + c;
+      if (gi < _ROWS - 1 && gj < _COLS - 1)
+        reference(c, r) = ((gi + gj) + (gi + 1 + gj) + (gi + gj + 1) + (gi + 1 + gj + 1)) / 4;
+    }
+  }
+
+  compare_buffers(std::string(TEST_NAME_STR) + std::to_string(rank), output, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
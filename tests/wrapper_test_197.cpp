@@ -0,0 +1,59 @@
+#include "wrapper_test_197.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+  int number_of_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks);
+  assert(number_of_ranks == _NUM_RANKS);
+
+  Halide::Buffer<int32_t> local(_N, "local");
+  Halide::Buffer<int32_t> blocks(_NUM_RANKS * _CHUNK, "blocks");
+  Halide::Buffer<int32_t> maximum(_N, "maximum");
+  Halide::Buffer<int32_t> gathered(_NUM_RANKS * _N, "gathered");
+  Halide::Buffer<int32_t> exchanged(_NUM_RANKS * _CHUNK, "exchanged");
+  Halide::Buffer<int32_t> reference_max(_N, "reference_max");
+  Halide::Buffer<int32_t> reference_gathered(_NUM_RANKS * _N, "reference_gathered");
+  Halide::Buffer<int32_t> reference_exchanged(_NUM_RANKS * _CHUNK, "reference_exchanged");
+
+  for (int i = 0; i < _N; i++) {
+    // The values are not monotonic in the rank, so that the max is not the
+    // value of the last rank.
+    local(i) = ((rank + 1) % _NUM_RANKS) * _N + i;
+    maximum(i) = 0;
+    reference_max(i) = (_NUM_RANKS - 1) * _N + i;
+  }
+  for (int r = 0; r < _NUM_RANKS; r++) {
+    for (int i = 0; i < _N; i++) {
+      gathered(r * _N + i) = 0;
+      reference_gathered(r * _N + i) = ((r + 1) % _NUM_RANKS) * _N + i;
+    }
+    for (int k = 0; k < _CHUNK; k++) {
+      // The element k of the block sent by the rank s to the rank r is s * 100 + r * _CHUNK + k.
+      blocks(r * _CHUNK + k) = rank * 100 + r * _CHUNK + k;
+      exchanged(r * _CHUNK + k) = 0;
+      reference_exchanged(r * _CHUNK + k) = r * 100 + rank * _CHUNK + k;
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  collectives(local.raw_buffer(), blocks.raw_buffer(), maximum.raw_buffer(), gathered.raw_buffer(),
+              exchanged.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " (allreduce max) " + std::to_string(rank), maximum, reference_max);
+  compare_buffers(std::string(TEST_NAME_STR) + " (allgather) " + std::to_string(rank), gathered, reference_gathered);
+  compare_buffers(std::string(TEST_NAME_STR) + " (alltoall) " + std::to_string(rank), exchanged, reference_exchanged);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
@@ -0,0 +1,29 @@
+#ifndef TIRAMISU_WRAPPER_TEST_197_H
+#define TIRAMISU_WRAPPER_TEST_197_H
+
+#define TEST_NAME_STR       "Reduction and scatter collective communications"
+#define TEST_NUMBER_STR     "197"
+
+//data size
+#define _N 10
+#define _CHUNK 3
+#define _NUM_RANKS 4
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int collectives(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer, halide_buffer_t *_p2_buffer,
+                halide_buffer_t *_p3_buffer, halide_buffer_t *_p4_buffer);
+int collectives_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
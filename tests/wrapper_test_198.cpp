@@ -0,0 +1,63 @@
+#include "wrapper_test_198.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+  int number_of_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks);
+  assert(number_of_ranks == _NUM_RANKS);
+
+  Halide::Buffer<int32_t> local(_N, "local");
+  Halide::Buffer<int32_t> blocks(_NUM_RANKS * _CHUNK, "blocks");
+  Halide::Buffer<int32_t> shared(_N, "shared");
+  Halide::Buffer<int32_t> sum(_N, "sum");
+  Halide::Buffer<int32_t> gathered(_NUM_RANKS * _N, "gathered");
+  Halide::Buffer<int32_t> exchanged(_NUM_RANKS * _CHUNK, "exchanged");
+  Halide::Buffer<int32_t> reference_shared(_N, "reference_shared");
+  Halide::Buffer<int32_t> reference_sum(_N, "reference_sum");
+  Halide::Buffer<int32_t> reference_gathered(_NUM_RANKS * _N, "reference_gathered");
+  Halide::Buffer<int32_t> reference_exchanged(_NUM_RANKS * _CHUNK, "reference_exchanged");
+
+  for (int i = 0; i < _N; i++) {
+    local(i) = rank * _N + i;
+    shared(i) = (rank == 0) ? i : -1;
+    sum(i) = 0;
+    // sum over r of (r * _N + i)
+    reference_sum(i) = _N * _NUM_RANKS * (_NUM_RANKS - 1) / 2 + _NUM_RANKS * i;
+    reference_shared(i) = i;
+  }
+  for (int r = 0; r < _NUM_RANKS; r++) {
+    for (int i = 0; i < _N; i++) {
+      gathered(r * _N + i) = 0;
+      reference_gathered(r * _N + i) = r * _N + i;
+    }
+    for (int k = 0; k < _CHUNK; k++) {
+      // The element k of the block sent by the rank s to the rank r is s * 100 + r * _CHUNK + k.
+      blocks(r * _CHUNK + k) = rank * 100 + r * _CHUNK + k;
+      exchanged(r * _CHUNK + k) = 0;
+      reference_exchanged(r * _CHUNK + k) = r * 100 + rank * _CHUNK + k;
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  collectives(local.raw_buffer(), blocks.raw_buffer(), shared.raw_buffer(), sum.raw_buffer(),
+              gathered.raw_buffer(), exchanged.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " (allreduce) " + std::to_string(rank), sum, reference_sum);
+  compare_buffers(std::string(TEST_NAME_STR) + " (broadcast) " + std::to_string(rank), shared, reference_shared);
+  compare_buffers(std::string(TEST_NAME_STR) + " (allgather) " + std::to_string(rank), gathered, reference_gathered);
+  compare_buffers(std::string(TEST_NAME_STR) + " (alltoall) " + std::to_string(rank), exchanged, reference_exchanged);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
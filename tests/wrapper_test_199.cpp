@@ -0,0 +1,37 @@
+#include "wrapper_test_199.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+
+  // The generated code checks that MPI was initialized with MPI_THREAD_MULTIPLE
+  int rank = tiramisu_MPI_init_hybrid();
+
+  Halide::Buffer<int32_t> input(_M, _N, "input");
+  Halide::Buffer<int32_t> output(_M, _N, "output");
+  Halide::Buffer<int32_t> reference(_M, _N, "reference");
+
+  for (int i = 0; i < _N; i++) {
+    for (int y = 0; y < _M; y++) {
+      input(y, i) = rank * _N * _M + i * _M + y;
+      // The rank 0 does not receive anything
+      reference(y, i) = (rank > 0) ? (rank - 1) * _N * _M + i * _M + y : 0;
+    }
+  }
+  init_buffer(output, (int32_t)0);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  parallel_rows(input.raw_buffer(), output.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " " + std::to_string(rank), output, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef TIRAMISU_WRAPPER_TEST_199_H
+#define TIRAMISU_WRAPPER_TEST_199_H
+
+#define TEST_NAME_STR       "Communication inside a parallel loop"
+#define TEST_NUMBER_STR     "199"
+
+#define _RANKS 4
+#define _N 16
+#define _M 8
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int parallel_rows(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer);
+int parallel_rows_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,63 @@
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "wrapper_test_200.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+void check_debug_level(const std::string &file, int expected)
+{
+    int level = tiramisu::get_debug_level(file.c_str());
+    if (level != expected)
+    {
+        ERROR("\033[1;31mTest " + std::string(TEST_NAME_STR) + " failed. Debugging level of " + file +
+              ", expected: " + std::to_string(expected) + ", got: " + std::to_string(level) + ".\033[0m\n", true);
+    }
+}
+
+int main(int, char **)
+{
+    // The environment variable is read when a debugging level is used for the first time
+    setenv("TIRAMISU_DEBUG_LEVEL", "1,codegen_halide=5,core=0", 1);
+
+    check_debug_level("src/tiramisu_codegen_halide.cpp", 5);
+    check_debug_level("/home/user/tiramisu/src/tiramisu_core.cpp", 0);
+    check_debug_level("tiramisu_function.cpp", 1);
+    // Another module, even if its name starts with the name of a module that has a level
+    check_debug_level("src/tiramisu_codegen_halide_lowering.cpp", 1);
+
+    tiramisu::set_debug_level("function", 4);
+    check_debug_level("src/tiramisu_function.cpp", 4);
+    check_debug_level("src/tiramisu_core.cpp", 0);
+
+    // Setting the level of all the modules overrides the levels of the modules
+    tiramisu::set_debug_level(2);
+    check_debug_level("src/tiramisu_codegen_halide.cpp", 2);
+    check_debug_level("src/tiramisu_core.cpp", 2);
+    check_debug_level("src/tiramisu_function.cpp", 2);
+
+    Halide::Buffer<int32_t> A(SIZE1, "A");
+    Halide::Buffer<int32_t> B(SIZE1, "B");
+    Halide::Buffer<int32_t> reference_B(SIZE1, "reference_B");
+
+    for (int i = 0; i < SIZE1; i++)
+    {
+        A(i) = i;
+        reference_B(i) = i + 1;
+    }
+    init_buffer(B, (int32_t)0);
+
+    tiramisu_generated_code(A.raw_buffer(), B.raw_buffer());
+
+    compare_buffers(std::string(TEST_NAME_STR), B, reference_B);
+
+    return 0;
+}
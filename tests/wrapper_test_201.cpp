@@ -0,0 +1,56 @@
+#include "wrapper_test_201.h"
+#include "Halide.h"
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+#define _BLOCK (_ROWS/_RANKS)
+
+// The value of the global row r and of the column c of the input
+uint32_t input_value(int r, int c) {
+  return r * 7 + c * 3 + 1;
+}
+
+uint32_t blurx_value(int r, int c) {
+  return (input_value(r, c) + input_value(r + 1, c) + input_value(r + 2, c)) / 3;
+}
+
+int main() {
+#ifdef WITH_MPI
+
+  int rank = tiramisu_MPI_init();
+
+  // The two last rows are received from the next rank, except on the last rank
+  Halide::Buffer<uint32_t> img(_COLS + 2, _BLOCK + 2, "img");
+  init_buffer(img, (uint32_t)0);
+  int received_rows = (rank < _RANKS - 1) ? _BLOCK : _BLOCK + 2;
+  for (int r = 0; r < received_rows; r++) {
+    for (int c = 0; c < _COLS + 2; c++) {
+      img(c, r) = input_value(rank * _BLOCK + r, c);
+    }
+  }
+
+  Halide::Buffer<uint32_t> output(_COLS, _BLOCK, "output");
+  Halide::Buffer<uint32_t> reference(_COLS, _BLOCK, "reference");
+  init_buffer(output, (uint32_t)0);
+
+  // The reference is computed from the global input, not from the received rows
+  for (int r = 0; r < _BLOCK; r++) {
+    int g = rank * _BLOCK + r;
+    for (int c = 0; c < _COLS; c++) {
+      reference(c, r) = (blurx_value(g, c) + blurx_value(g, c + 1) + blurx_value(g, c + 2)) / 3;
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  overlapped_blur(img.raw_buffer(), output.raw_buffer());
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  compare_buffers(std::string(TEST_NAME_STR) + " " + std::to_string(rank), output, reference);
+
+  tiramisu_MPI_cleanup();
+
+#endif
+  return 0;
+}
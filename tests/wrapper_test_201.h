@@ -0,0 +1,28 @@
+#ifndef TIRAMISU_WRAPPER_TEST_201_H
+#define TIRAMISU_WRAPPER_TEST_201_H
+
+#define TEST_NAME_STR       "Interior and boundary regions of an overlapped communication"
+#define TEST_NUMBER_STR     "201"
+
+#define _RANKS 4
+//data size
+#define _ROWS 32
+#define _COLS 10
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int overlapped_blur(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer);
+int overlapped_blur_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
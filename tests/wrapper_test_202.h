@@ -0,0 +1,29 @@
+#ifndef TIRAMISU_WRAPPER_TEST_202_H
+#define TIRAMISU_WRAPPER_TEST_202_H
+
+#define TEST_NAME_STR       "Distributed 2D blur with buffer::distribute() on a process grid"
+#define TEST_NUMBER_STR     "202"
+
+//data size
+#define _ROWS 21
+#define _COLS 19
+#define _TILE_ROWS ((_ROWS + 1) / 2)
+#define _TILE_COLS ((_COLS + 1) / 2)
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int blur2d(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer);
+int blur2d_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif